@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""
+@file gen_panel_glyphs.py
+@brief Generates the pre-composed, panel-order glyph tables of the tuner views.
+
+Reads the source glyphs from ../src/bitmap_fonts.h and writes ../src/panel_glyphs.h
+(PROGMEM), so the renderer copies whole frame buffer bytes instead of shifting
+and merging glyphs at runtime:
+
+  panel_keyboard_label      module 5 label of the keyboard view: note name
+                            (font_tall6_notes_condensed, bits 7..5, rows 1..6)
+                            merged with the flat / sharp sign (font_tall6_alterations,
+                            rows 0..2), one 8-byte glyph per note and alteration.
+                            Rows 4..7 leave bits 3..1 free for font_micro_numbers.
+  panel_keyboard_column     per cursor column 0..27: label glyph index, frame
+                            buffer index of row 6 and that byte of font_keyboard
+                            with the cursor pixel set.
+  panel_small_numbers_2     two-digit numbers 00..99 of font_small_numbers,
+                            tens in the high, units in the low nibble.
+
+usage: python3 gen_panel_glyphs.py   (no external dependencies)
+
+(c) GNU GPL v3 or later.
+"""
+
+import os
+import re
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+SRC_DIR = os.path.join(SCRIPT_DIR, "..", "src")
+FONTS = "bitmap_fonts.h"
+OUTPUT = "panel_glyphs.h"
+
+KEYBOARD_COLUMNS = 28
+KEYBOARD_CURSOR_ROW = 6
+
+# column -> note label (0 = C .. 6 = B) and alteration (-1 flat, 0 natural, +1 sharp)
+COLUMN_NOTE = [6, 0, 0, 0,  0, 1, 1, 1,  1, 2, 2, 2,  2, 3, 3, 3,
+               3, 4, 4, 4,  4, 5, 5, 5,  5, 6, 6, 6]
+COLUMN_ALTERATION = [+1, -1, 0, +1] * 7
+NOTE_NAMES = "CDEFGAB"
+ALTERATION_NAMES = {-1: "b", 0: " ", +1: "#"}
+
+
+def read_table(source, name):
+    """Flat list of the initializer values of `name` in the header text."""
+    match = re.search(r"\b%s\b[^=]*=\s*\{(.*?)\};" % re.escape(name), source, re.S)
+    if not match:
+        raise ValueError("%s not found in %s" % (name, FONTS))
+    body = re.sub(r"/\*.*?\*/|//[^\n]*", "", match.group(1), flags=re.S)
+    return [int(v, 0) for v in re.findall(r"0[xXbB][0-9a-fA-F]+|\d+", body)]
+
+
+def rows(values, width):
+    return [values[i:i + width] for i in range(0, len(values), width)]
+
+
+def format_bytes(values):
+    return ", ".join("0x%02X" % v for v in values)
+
+
+def main():
+    with open(os.path.join(SRC_DIR, FONTS)) as f:
+        source = f.read()
+    notes = rows(read_table(source, "font_tall6_notes_condensed"), 6)
+    alterations = rows(read_table(source, "font_tall6_alterations"), 3)
+    small_numbers = rows(read_table(source, "font_small_numbers"), 5)
+    keyboard = read_table(source, "font_keyboard")
+
+    out = []
+    out.append("/* Tuner view glyphs in panel order - generated by scripts/gen_panel_glyphs.py from")
+    out.append(" * bitmap_fonts.h, do not edit. One byte per frame buffer byte (8 per module, row 0 first, MSB left).")
+    out.append(" */")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("#ifndef _PANEL_GLYPHS_H_")
+    out.append("#define _PANEL_GLYPHS_H_")
+    out.append("")
+    out.append("#define PANEL_KEYBOARD_COLUMNS      %d" % KEYBOARD_COLUMNS)
+    out.append("")
+
+    out.append("// keyboard view label (module 5): note * 3 + flat / natural / sharp, rows 4..7 bits 3..1 free for the octave")
+    out.append("const uint8_t panel_keyboard_label[%d][8] PROGMEM = {" % (len(NOTE_NAMES) * 3))
+    for n, name in enumerate(NOTE_NAMES):
+        for alteration in (-1, 0, +1):
+            glyph = []
+            for row in range(8):
+                b = (notes[n][row - 1] << 5) & 0xFF if 1 <= row <= 6 else 0
+                if row < 3 and alteration != 0:
+                    b |= alterations[0 if alteration < 0 else 1][row]
+                glyph.append(b)
+            out.append("    { %s }, /* '%s%s' */" % (format_bytes(glyph), name, ALTERATION_NAMES[alteration]))
+    out.append("};")
+    out.append("")
+
+    out.append("// keyboard view cursor: label glyph, frame buffer index and byte of row %d with the cursor pixel" %
+               KEYBOARD_CURSOR_ROW)
+    out.append("typedef struct {")
+    out.append("    uint8_t label;      // panel_keyboard_label index")
+    out.append("    uint8_t index;      // frame buffer index of the cursor row")
+    out.append("    uint8_t cursor;     // font_keyboard byte at index with the cursor pixel toggled")
+    out.append("} panel_keyboard_column_t;")
+    out.append("")
+    out.append("const panel_keyboard_column_t panel_keyboard_column[PANEL_KEYBOARD_COLUMNS] PROGMEM = {")
+    for col in range(KEYBOARD_COLUMNS):
+        label = COLUMN_NOTE[col] * 3 + COLUMN_ALTERATION[col] + 1
+        index = (col // 8) * 8 + KEYBOARD_CURSOR_ROW
+        cursor = keyboard[index] ^ (0x80 >> (col % 8))
+        out.append("    { %2d, %2d, 0x%02X }, /* column %2d */" % (label, index, cursor, col))
+    out.append("};")
+    out.append("")
+
+    out.append("// two-digit numbers of font_small_numbers, 5 rows")
+    out.append("const uint8_t panel_small_numbers_2[100][5] PROGMEM = {")
+    for value in range(100):
+        tens, units = small_numbers[value // 10], small_numbers[value % 10]
+        glyph = [(tens[row] << 4) | units[row] for row in range(5)]
+        out.append("    { %s }, /* %02d */" % (format_bytes(glyph), value))
+    out.append("};")
+    out.append("")
+    out.append("#endif // _PANEL_GLYPHS_H_")
+
+    with open(os.path.join(SRC_DIR, OUTPUT), "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("%s written" % OUTPUT)
+
+
+if __name__ == "__main__":
+    main()
@@ -17,6 +17,10 @@
 #define __HT1635_H__
 
 #define HT1635_I2C_ADDRESS 0x68
+#define HT1635_I2C_CLOCK 100000UL	// SCL frequency (Hz), standard mode
+#define HT1635_I2C_CLOCK_FAST 400000UL	// SCL frequency (Hz) with DISPLAY_I2C_FAST_MODE
+#define HT1635_I2C_ERROR_LIMIT 3	// consecutive failed transactions before falling back to HT1635_I2C_CLOCK
+#define HT1635_TWI_QUEUE_SIZE 64	// transmit queue bytes, power of 2 (<= 128)
 
 /**
  * @brief Customized class to interface a HT1635 LED display driver
@@ -24,7 +28,10 @@
  * 
  * This class implements both the HAL internals and methods and
  * the pitch / note drift renderers.
- * Due to tight integration with the I2C Wire implementation
+ * The I2C transfers are done by the class' own TWI interrupt driven
+ * transmit queue instead of the blocking Wire library, so drawing and
+ * flush() return at once while the loop keeps serving UART and GATE.
+ * Due to tight integration with the I2C implementation
  * and non-optimal electrical layout implemented in the current
  * display board (row and columns are swapped for each display module)
  * to optimize data writes and save resources, both translation units
@@ -41,7 +48,19 @@ public:
 	 * PUBLIC HT1635 HAL
 	 */
 
+	/**
+	 * @brief Draws the logo at PWM 0 and starts its fade-in.
+	 *
+	 * Returns at once, the fade is advanced by startup_logo_step().
+	 */
 	void display_startup_logo();
+	/**
+	 * @brief Advances the logo fade-in one PWM level every LOGO_FADE_STEP_MS.
+	 * @retval true while the fade (and the hold at full brightness) runs
+	 */
+	bool startup_logo_step(unsigned long now_ms);
+	/** @brief Ends the logo fade-in at full brightness. */
+	void startup_logo_finish();
 	void display_keyboard();
 	void display_keyboard_drift(float freq, float ref_a4);
 
@@ -139,11 +158,27 @@ public:
 	void print_char(char theChar, uint8_t at, bool restart);
 	uint8_t write_byte(uint8_t ramByteIndex, uint8_t value);
 
+	/**
+	 * @brief  Send the bytes changed since the last flush to the display
+	 *
+	 * All print / render methods only draw into the frame buffer,
+	 * call this once per UI loop to make the changes visible.
+	 * @retval error
+	 */
+	uint8_t flush();
+
+	/** @brief Block until the transmit queue has been sent out. */
+	void wait_idle();
+
+	/** @return true while the bus runs at HT1635_I2C_CLOCK_FAST. */
+	bool i2c_fast_mode() const { return _twi_fast; }
+
+	/** @brief TWI interrupt service, only to be called from ISR(TWI_vect). */
+	static void twi_service();
+
 	/***********************************************************
 	 * PUBLIC TUNER RENDERER AND PITCH DETECTION METHODS AND INTERNALS
 	 */
-	const char* frequency_to_note(float freq, float pitch_concert_a, float* cent_drift, int16_t*midi_note);
-
 	/**
 	 * @brief Tuner rendering modes.
 	 */
@@ -182,7 +217,26 @@ private:
 	uint8_t _memory_pointer = 0;		// display memory index
 
 	static const uint8_t HT_RAM_LAST_ADDRESS = 40;
-	uint8_t _bitmap_buffer[40];
+	static const uint8_t HT_MAX_RUN_BYTES = HT_RAM_LAST_ADDRESS;	// RAM address auto increments, a whole frame is one run
+	static const uint8_t HT_DIRTY_GAP_MERGE = 3;		// clean bytes sent along instead of a new transaction
+	uint8_t _bitmap_buffer[40];							// frame buffer, byte i is at RAM address i * 2
+	uint8_t _dirty[(HT_RAM_LAST_ADDRESS + 7) / 8];		// one bit per _bitmap_buffer byte changed since flush()
+
+	/** Draws one frame buffer byte, marks it dirty if it changed. */
+	void set_byte(uint8_t index, uint8_t value) {
+		if (index >= HT_RAM_LAST_ADDRESS || _bitmap_buffer[index] == value) { return; }
+		_bitmap_buffer[index] = value;
+		_dirty[index >> 3] |= (uint8_t)(1u << (index & 7));
+	}
+	bool is_dirty(uint8_t index) const { return _dirty[index >> 3] & (uint8_t)(1u << (index & 7)); }
+	void invalidate();
+
+	// startup logo fade-in, see startup_logo_step()
+	static const uint8_t LOGO_IDLE = 0xFF;
+	static const uint8_t LOGO_PWM_MAX = 15;
+	static const uint16_t LOGO_FADE_STEP_MS = 200;
+	uint8_t _logo_level = LOGO_IDLE;		// PWM level of the fade, LOGO_PWM_MAX + 1 while holding
+	unsigned long _logo_tick = 0;			// millis() of the last fade step
 
 	// defaults
 	uint8_t _pwm_setting = 0x00; 									// default PWM value
@@ -191,16 +245,32 @@ private:
 	power_mode_t _power_mode = POWER_OFF; 							// default power mode
 	cascade_mode_t _cascade_mode = RC_MASTERMODE_0; 				// default cascade mode
 
+	/*
+	 * TWI transmit queue: records of [length][byte 0 .. length-1] in a ring,
+	 * filled by twi_enqueue() and streamed to the device by twi_service().
+	 * Free running 8-bit indexes, the ISR only moves _twi_tail.
+	 */
+	static volatile uint8_t _twi_queue[HT1635_TWI_QUEUE_SIZE];
+	static volatile uint8_t _twi_head;			// next free byte (loop only)
+	static volatile uint8_t _twi_tail;			// next byte to send (ISR only)
+	static volatile uint8_t _twi_remaining;		// bytes left in the record on the bus
+	static volatile bool _twi_busy;				// a transaction is in progress
+	static volatile uint8_t _twi_error;			// TWI status of the last transaction if it failed, 0 if it went fine
+	static uint8_t _twi_sla_w;					// device address + write bit
+	static volatile bool _twi_fast;				// running at HT1635_I2C_CLOCK_FAST
+	static volatile uint8_t _twi_error_count;	// consecutive failed transactions
+
+	void twi_init();
+	bool twi_pullups_present();
+	uint8_t twi_enqueue(uint8_t b0, uint8_t b1, const uint8_t* data, uint8_t count);
+
 	uint8_t send_cmd(command_opcode_t command, uint8_t mode);
-	uint8_t ParamTx(uint8_t val, uint8_t rown);
-	void i2c_sendout_bitmap(uint8_t start = 0);
+	uint8_t i2c_sendout_bitmap(uint8_t first, uint8_t count);
 	void UpdateRegisters(void);
 
 	/**
 	 * PRIVATE TUNER RENDERER INTERNALS
 	 */
-	// Precompute 1/ln(2) to avoid a division on AVR.
-    const float INV_LN2 = 1.4426950408889634f; // 1 / 0.69314718056
 	tuner_view_mode_t _tuner_view_mode = tuner_view_mode_t::piano_view;
 
 
@@ -13,16 +13,22 @@
 #include "HT1635.h"
 #include "freq.h"
 #include "../../eeprom.h"
+#include "../../link_protocol.h"
 
 
 // ==== Configuration & constants =================================================
 
-/** EEPROM addresses (byte indices). */
+/** Former fixed EEPROM addresses (byte indices), only read to migrate to the settings record. */
 static constexpr uint16_t EEPROM_TUNER_VIEW_MODE_ADDRESS = 0x00;
 static constexpr uint16_t EEPROM_CONCERT_REF_A_ADDRESS   = 0x01;
 
+/** Settings record ring, see EESettings in eeprom.h: 16 slots of 9 bytes after the former addresses. */
+static constexpr int EEPROM_SETTINGS_BASE = 0x10;
+static constexpr uint8_t EEPROM_SETTINGS_SLOTS = 16;
+static constexpr uint8_t EEPROM_SETTINGS_VERSION = 1;
+
 /** UI timing (ms). */
-static constexpr uint32_t UI_UPDATE_DELAY_MS = 100;
+static constexpr uint32_t UI_UPDATE_DELAY_MS = 20;   // only changed display bytes are sent, see HT1635::flush()
 static constexpr uint32_t UI_TEMPORARY_PARAMETER_DISPLAY_MS = 1800;
 
 /** Concert A bounds (Hz) for validation. */
@@ -35,14 +41,24 @@ static constexpr float MIN_VALID_FREQ = 10.0f;
 
 // ==== Types =====================================================================
 
+/**
+ * @brief Persistent settings of the display, one EESettings record.
+ */
+typedef struct {
+    uint8_t tuner_view_mode;        /**< HT1635::tuner_view_mode_t */
+    float concert_reference_a;      /**< Hz */
+} display_settings_t;
+
 /**
  * @brief UI "page" / status machine for the display.
  */
 typedef enum : uint8_t {
     tuner_view = 0,                 /**< Main tuner page. */
+    startup_logo,                   /**< Logo fade-in after power-up, ends on the first command. */
 
     // Menu items (cycled by short presses, confirmed by long press)
     menu_item_cal_enter,
+    menu_item_cal_quick_enter,
     menu_item_pitch_display_mode_numeric,
     menu_item_pitch_display_mode_bar,
     menu_item_pitch_display_mode_keyboard,
@@ -78,6 +94,39 @@ static display_status_parameter_t _parameter_display_status = none;
 
 static uint8_t _parameter_value = 0;
 static float _concert_reference_a = CONCERT_A_DEFAULT;
+static EESettings<display_settings_t, EEPROM_SETTINGS_BASE, EEPROM_SETTINGS_SLOTS, EEPROM_SETTINGS_VERSION> _settings;
+
+#ifdef PITCH_QUANTIZER
+/**
+ * @brief Tell the theremin quantizer the Concert A of the tuner, 430..445 Hz only.
+ */
+static void send_concert_a() {
+    const int16_t offset = (int16_t)lroundf(_concert_reference_a) - STATE_CMD_CONCERT_A_MIN;
+    if (offset >= 0 && offset < STATE_CMD_CONCERT_A_COUNT) {
+        Serial.write((uint8_t)(STATE_CMD_CONCERT_A_BASE + offset));
+    }
+}
+#endif
+
+/**
+ * @brief Store the view mode and Concert A, into the next slot of the ring if changed.
+ */
+static void settings_write() {
+    _settings.data.tuner_view_mode = ht_display.get_tuner_view_mode();
+    _settings.data.concert_reference_a = _concert_reference_a;
+    _settings.save();
+    #ifdef PITCH_QUANTIZER
+        send_concert_a();   // also after loading, see settings_read()
+    #endif
+}
+
+#ifdef LINK_STATUS_FRAMES
+/** DDS phase increment to Hz: 31250 Hz sample rate / 65536 phase steps per cycle. */
+static constexpr float DDS_INCREMENT_TO_HZ = 31250.0f / 65536.0f;
+static link_parser_t _link = {};
+static float _link_frequency = 0.0f;            // pitch from the last status frame
+static unsigned long _link_frequency_tick = 0;  // millis() of the last status frame
+#endif
 
 // ==== Accessors =================================================================
 
@@ -91,9 +140,10 @@ void restore_tuner_view() {
 }
 
 
+/** Start the logo fade-in, the loop advances it and then shows the tuner view. */
 void display_ui_init() {
     ht_display.display_startup_logo();
-    ht_display.update_display();
+    _display_status = startup_logo;
 }
 
 /**
@@ -116,6 +166,7 @@ void display_menu(theremin_status_display_t status) {
     HT1635::tuner_view_mode_t tuner_view_mode = ht_display.get_tuner_view_mode();
     switch (status) {
         case menu_item_cal_enter: display_status_msg(menu_txt, "CAL? "); break;
+        case menu_item_cal_quick_enter: display_status_msg(menu_txt, "QCAL?"); break;
         
         case menu_item_pitch_display_mode_numeric:
             if (tuner_view_mode == HT1635::tuner_view_mode_t::numeric) {
@@ -179,7 +230,10 @@ void display_menu(theremin_status_display_t status) {
  * @param shortPress true for short press, false for long press.
  */
 void handle_user_action(bool shortPress) {
-    HT1635::tuner_view_mode_t tuner_view_mode = ht_display.get_tuner_view_mode();
+    if (_theremin_state == calibrating) {
+        Serial.write(STATE_CMD_CALIBRATION_CANCEL);     // any press cancels a running calibration
+        return;
+    }
     bool shall_restore_tuner_view = false;
     switch (_display_status) {
         case tuner_view:
@@ -196,18 +250,26 @@ void handle_user_action(bool shortPress) {
 
         case menu_item_cal_enter:
             if (shortPress) {
-                display_menu(menu_item_pitch_display_mode_numeric);
+                display_menu(menu_item_cal_quick_enter);
             } else {
                 Serial.write(STATE_CMD_CALIBRATION);
             }
             break;
 
+        case menu_item_cal_quick_enter:
+            if (shortPress) {
+                display_menu(menu_item_pitch_display_mode_numeric);
+            } else {
+                Serial.write(STATE_CMD_CALIBRATION_QUICK);
+            }
+            break;
+
         case menu_item_pitch_display_mode_numeric:
             if (shortPress) {
                 display_menu(menu_item_pitch_display_mode_bar);
             } else {
-                tuner_view_mode = ht_display.set_tuner_view_mode(HT1635::tuner_view_mode_t::numeric);
-                EEPROM.put(EEPROM_TUNER_VIEW_MODE_ADDRESS, tuner_view_mode);
+                ht_display.set_tuner_view_mode(HT1635::tuner_view_mode_t::numeric);
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -216,8 +278,8 @@ void handle_user_action(bool shortPress) {
             if (shortPress) {
                 display_menu(menu_item_pitch_display_mode_keyboard);
             } else {
-                tuner_view_mode = ht_display.set_tuner_view_mode(HT1635::tuner_view_mode_t::bar_graph);
-                EEPROM.put(EEPROM_TUNER_VIEW_MODE_ADDRESS, tuner_view_mode);
+                ht_display.set_tuner_view_mode(HT1635::tuner_view_mode_t::bar_graph);
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -226,8 +288,8 @@ void handle_user_action(bool shortPress) {
             if (shortPress) {
                 display_menu(menu_item_concert_a_440);
             } else {
-                tuner_view_mode = ht_display.set_tuner_view_mode(HT1635::tuner_view_mode_t::piano_view);
-                EEPROM.put(EEPROM_TUNER_VIEW_MODE_ADDRESS, tuner_view_mode);
+                ht_display.set_tuner_view_mode(HT1635::tuner_view_mode_t::piano_view);
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -237,7 +299,7 @@ void handle_user_action(bool shortPress) {
                 display_menu(menu_item_concert_a_445);
             } else {
                 _concert_reference_a = 440.0f;
-                EEPROM.put(EEPROM_CONCERT_REF_A_ADDRESS, _concert_reference_a); 
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -247,7 +309,7 @@ void handle_user_action(bool shortPress) {
                 display_menu(menu_item_concert_a_430);
             } else {
                 _concert_reference_a = 445.0f;
-                EEPROM.put(EEPROM_CONCERT_REF_A_ADDRESS, _concert_reference_a); 
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -257,7 +319,7 @@ void handle_user_action(bool shortPress) {
                 display_menu(menu_item_concert_a_432);
             } else {
                 _concert_reference_a = 430.0f;
-                EEPROM.put(EEPROM_CONCERT_REF_A_ADDRESS, _concert_reference_a); 
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -267,7 +329,7 @@ void handle_user_action(bool shortPress) {
                 shall_restore_tuner_view = true;
             } else {
                 _concert_reference_a = 432.0f;
-                EEPROM.put(EEPROM_CONCERT_REF_A_ADDRESS, _concert_reference_a); 
+                settings_write();
                 shall_restore_tuner_view = true;
             }
             break;
@@ -282,37 +344,151 @@ void handle_user_action(bool shortPress) {
 
 /**
  * @brief Read persistent settings from EEPROM and validate.
+ *
+ * One block read of the newest settings record. Without a valid record
+ * the values at the former fixed addresses are taken over once.
  */
 static void settings_read() {
+    if (!_settings.load()) {
+        EEPROM.get(EEPROM_TUNER_VIEW_MODE_ADDRESS, _settings.data.tuner_view_mode);
+        EEPROM.get(EEPROM_CONCERT_REF_A_ADDRESS, _settings.data.concert_reference_a);
+    }
+
     // View mode
-    int8_t tvm = 0;
-    EEPROM.get(EEPROM_TUNER_VIEW_MODE_ADDRESS, tvm);
-    if (tvm < 0 || tvm >= HT1635::tuner_view_mode_t::tuner_view_mode_t_last) {
+    uint8_t tvm = _settings.data.tuner_view_mode;
+    if (tvm >= HT1635::tuner_view_mode_t::tuner_view_mode_t_last) {
         tvm = HT1635::tuner_view_mode_t::piano_view;
     }
     HT1635::tuner_view_mode_t tuner_view_mode = static_cast<HT1635::tuner_view_mode_t>(tvm);
     ht_display.set_tuner_view_mode(tuner_view_mode);
 
-    float ref_a = 0.0f;
-    EEPROM.get(EEPROM_CONCERT_REF_A_ADDRESS, ref_a);
-    if (ref_a < CONCERT_A_MIN || ref_a > CONCERT_A_MAX) {
+    float ref_a = _settings.data.concert_reference_a;
+    if (!(ref_a >= CONCERT_A_MIN && ref_a <= CONCERT_A_MAX)) {     // also catches NAN of a blank EEPROM
         ref_a = CONCERT_A_DEFAULT;
     }
     _concert_reference_a = ref_a;
+    settings_write();   // stores the validated / migrated values, no write if unchanged
 }
 
 /**
- * @brief Initialize the HT1635 display and show startup screen.
+ * @brief Initialize the HT1635 display and start the startup screen.
+ *
+ * Nothing here waits: the logo fades in from the loop, while the
+ * frequency measurement and the UART protocol already run.
  */
 void setup() {
     Serial.begin(SERIAL_SPEED);
     settings_read();
+    #ifndef MIDI_OUTPUT
+        freq_init();    // with MIDI_OUTPUT the GATE line carries MIDI, not the pitch
+    #endif
     ht_display.begin();
     display_ui_init();
-    freq_init();
     DEBUG_PRINTLN(F("Display UI ready."));
-    _display_status = tuner_view;
+    #ifdef SERIAL_DEBUG_MESSAGES
+        Serial.print(F("Ready after ")); Serial.print(micros()); Serial.println(F(" us"));
+    #endif
+}
+
+/**
+ * @brief Handle a single-byte STATE_CMD_xxx from the Theremin.
+ */
+static void handle_command(uint8_t b) {
+    if (_display_status == startup_logo) {
+        ht_display.startup_logo_finish();   // the theremin is up, show what it reports
+        restore_tuner_view();
+        #ifdef PITCH_QUANTIZER
+            send_concert_a();   // in case it missed the one sent from setup()
+        #endif
+    }
+
+    switch (b) {
+        case STATE_CMD_MUTE:
+            _theremin_state = muted;
+            display_status_msg(status_msg, "MUTED");
+            break;
+
+        case STATE_CMD_UNMUTE:
+            _theremin_state = playing;
+            display_status_msg(status_msg, "PLAY!");
+            break;
+
+        case STATE_CMD_CALIBRATION:
+            _theremin_state = calibrating;
+            display_status_msg(status_msg, "-CAL-");
+            ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_1Hz);
+            break;
+
+        case STATE_CMD_CALIBRATION_QUICK:
+            _theremin_state = calibrating;
+            display_status_msg(status_msg, "QCAL-");
+            ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_1Hz);
+            break;
+
+        case STATE_CMD_CALIBRATION_SUCCESS:
+            _theremin_state = playing;
+            ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_OFF);
+            display_status_msg(status_msg, "CALOK");
+            break;
+
+        case STATE_CMD_CALIBRATION_ERROR:
+            _theremin_state = muted;
+            ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_OFF);
+            display_status_msg(status_msg, "CALER");
+            _display_status = menu_item_cal_enter;
+            break;
+
+        case STATE_CMD_CALIBRATION_CANCEL:
+            _theremin_state = muted;
+            ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_OFF);
+            display_status_msg(status_msg, "CANCL");
+            break;
+
+        case STATE_CMD_BUTTON_SHORT_PRESS:
+            handle_user_action(true);
+            break;
+
+        case STATE_CMD_BUTTON_LONG_PRESS:
+            handle_user_action(false);
+            break;
+
+        default:
+            // Parameter ranges: Register (octave) and Timbre (wavetable index).
+            if (b >= STATE_CMD_REGISTER_LOW && b <= STATE_CMD_REGISTER_HIGH) {
+                _display_status = parameter_change_view_temporary_enter;
+                _parameter_display_status = octave;
+                _parameter_value = b;
+            } else if (b >= STATE_CMD_WAVEFORM_BASE && b < (STATE_CMD_WAVEFORM_BASE + STATE_CMD_WAVEFORM_MAX)) {
+                _display_status = parameter_change_view_temporary_enter;
+                _parameter_display_status = timbre;
+                _parameter_value = b - STATE_CMD_WAVEFORM_BASE;
+            } else if (b >= STATE_CMD_CALIBRATION_PROGRESS_BASE && b < (STATE_CMD_CALIBRATION_PROGRESS_BASE + 20)) {
+                // calibration progress in 5 % steps: "CAL45"
+                uint8_t percent = (b - STATE_CMD_CALIBRATION_PROGRESS_BASE) * 5;
+                char txt[6] = "CAL  ";
+                txt[3] = char((percent / 10) + '0');
+                txt[4] = char((percent % 10) + '0');
+                display_status_msg(status_msg, txt);
+            } else {
+                // Unrecognized; ignore or DEBUG_PRINT(b);
+                //DEBUG_PRINT(b); // echo
+            }
+            break;
+    }
+}
+
+#ifdef LINK_STATUS_FRAMES
+/**
+ * @brief Handle a frame from the Theremin (see link_protocol.h).
+ */
+static void handle_frame(const link_parser_t *frame) {
+    if (frame->type == LINK_FRAME_STATUS) {
+        uint16_t increment = frame->payload[0] | ((uint16_t)frame->payload[1] << 8);
+        _link_frequency = increment * DDS_INCREMENT_TO_HZ;
+        _link_frequency_tick = millis();
+    }
 }
+#endif
 
 // ==== Arduino lifecycle ==========================================================
 
@@ -320,69 +496,43 @@ void loop() {
     static unsigned long tuner_view_update_old_tick = 0;
     static unsigned long parameter_view_update_old_tick = 0;
 
-    float raw = freq_read();
+    #ifdef MIDI_OUTPUT
+        float raw = 0.f;    // no GATE measurement, "no signal" once the status frames stop
+    #else
+        float raw = freq_read();
+    #endif
     unsigned long t = millis();
     
     // ---- UART protocol from Theremin ------------------------------------------
-    if (Serial.available()) {
+    while (Serial.available()) {
         uint8_t b = Serial.read();
-        switch (b) {
-            case STATE_CMD_MUTE:
-                _theremin_state = muted;
-                display_status_msg(status_msg, "MUTED");
-                break;
-
-            case STATE_CMD_UNMUTE:
-                _theremin_state = playing;
-                display_status_msg(status_msg, "PLAY!");
-                break;
-
-            case STATE_CMD_CALIBRATION:
-                _theremin_state = calibrating;
-                display_status_msg(status_msg, "-CAL-");
-                ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_1Hz);
-                break;
-
-            case STATE_CMD_CALIBRATION_SUCCESS:
-                _theremin_state = playing;
-                ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_OFF);
-                display_status_msg(status_msg, "CALOK");
-                break;
-
-            case STATE_CMD_CALIBRATION_ERROR:
-                _theremin_state = muted;
-                ht_display.set_blink_mode(HT1635::blink_setting_t::BLINK_OFF);
-                display_status_msg(status_msg, "CALER");
-                _display_status = menu_item_cal_enter;
-                break;
-
-            case STATE_CMD_BUTTON_SHORT_PRESS:
-                handle_user_action(true);
-                break;
-
-            case STATE_CMD_BUTTON_LONG_PRESS:
-                handle_user_action(false);
-                break;
-
-            default:
-                // Parameter ranges: Register (octave) and Timbre (wavetable index).
-                if (b >= STATE_CMD_REGISTER_LOW && b <= STATE_CMD_REGISTER_HIGH) {
-                    _display_status = parameter_change_view_temporary_enter;
-                    _parameter_display_status = octave;
-                    _parameter_value = b;
-                } else if (b >= STATE_CMD_WAVEFORM_BASE && b <= (STATE_CMD_WAVEFORM_BASE + 0x9)) {
-                    _display_status = parameter_change_view_temporary_enter;
-                    _parameter_display_status = timbre;
-                    _parameter_value = b - STATE_CMD_WAVEFORM_BASE;
-                } else {
-                    // Unrecognized; ignore or DEBUG_PRINT(b);
-                    //DEBUG_PRINT(b); // echo
-                }
-                break;
-        }
+        #ifdef LINK_STATUS_FRAMES
+            link_result_t result = link_parse(&_link, b);
+            if (result == link_result_t_frame) {
+                handle_frame(&_link);
+            } else if (result == link_result_t_command) {
+                handle_command(b);
+            }
+        #else
+            handle_command(b);
+        #endif
     }
 
+    #ifdef LINK_STATUS_FRAMES
+        // the pitch sent by the Theremin has no measurement latency, the GATE measurement is the fallback
+        // (none with MIDI_OUTPUT)
+        if (millis() - _link_frequency_tick < LINK_STATUS_TIMEOUT_MS) {
+            raw = _link_frequency;
+        }
+    #endif
+
     switch (_display_status) {
+        case startup_logo:
+            if (!ht_display.startup_logo_step(t)) {
+                restore_tuner_view();
+            }
+            break;
+
         case tuner_view:
             if (t - tuner_view_update_old_tick > UI_UPDATE_DELAY_MS) {
                 tuner_view_update_old_tick = t;
@@ -405,6 +555,7 @@ void loop() {
 
                 case timbre: {
                     char txt[6] = "WAV  ";
+                    if (_parameter_value >= 10) { txt[3] = char((_parameter_value / 10) + '0'); }
                     txt[4] = char((_parameter_value % 10) + '0');
                     ht_display.print_string5(txt);
                 } break;
@@ -428,9 +579,6 @@ void loop() {
 
         default: break;
     }
-        
-
-        
-
 
+    ht_display.flush();
 }
@@ -2,10 +2,14 @@
  * @file freq.cpp
  * @brief Robust frequency measurement on AVR (ATmega328P) using Timer1 Input Capture.
  *
- * - Timer1 @ F_CPU/8 => 2 MHz tick (0.5 µs).
+ * - Timer1 @ F_CPU => 16 MHz tick (62.5 ns).
  * - Uses 32-bit "extended capture" timestamps (overflow-safe).
+ * - The ISR only queues edge timestamps in a lock-free ring, freq_read() drains it,
+ *   so no period is lost while the loop is busy rendering.
+ * - Periods off the running median are rejected (glitches, lost edges).
+ * - Reciprocal counting: whole periods are summed up to a gate of at least
+ *   GATE_TICKS, f = periods * clock / ticks, one division per gate.
  * - Valid band defaults to ~30 Hz … 10 kHz (tunable).
- * - Optional EMA smoothing (alpha = 1/4) with NaN-safe handling.
  * - Returns 0.f if no signal or out of range for a while.
  * 
  * (c) 2025 Luca Cipressi (lucaji.github.io)
@@ -19,14 +23,21 @@
 
 #include "freq.h"
 #include "../../build_options.h"
-#include <util/atomic.h>
 #include <math.h>     // isfinite()
 
 /*
- *     Timer1 runs at 2 MHz, giving 0.5 µs resolution.
- *     Frequency accuracy is best from 30 Hz to 10 kHz.
+ *     Timer1 runs at 16 MHz, giving 62.5 ns resolution.
  *     ICR1 (Input Capture Register) is used to get precise rising edge timestamps.
- *     Overflow handling allows low frequencies down to ~1 Hz, though less precise.
+ *     freq_read() sums accepted periods until at least GATE_TICKS are reached,
+ *     so the number of periods N in a gate adapts to the input frequency:
+ *     ~20 periods at 10 kHz, one period (33 ms) at 30 Hz.
+ *     The gate is measured with +-1 tick, over >= 32768 ticks the result is
+ *     within 3e-5 (0.05 cent) everywhere in the band, instead of +-1 tick of a
+ *     single period (0.5 %, 9 cents, of 200 ticks at 10 kHz with the former clk/8).
+ *     The next gate starts at the last edge of the previous one, there is no dead time.
+ *     A period deviating more than 1/8 (~2 semitones) from the median of the
+ *     last MEDIAN_PERIODS periods is left out of the gate.
+ *     Overflow handling allows low frequencies down to ~1 Hz.
  */
  
 // Frequency input on D8 (ICP1 pin)
@@ -34,47 +45,63 @@
 
 // ====================== User-tunable constants =================================
 
-// Timer1 prescaler = 8 => 2 MHz on 16 MHz boards.
-#define TIMER1_PRESCALER    8UL
-#define TIMER1_CLK_HZ     (F_CPU / TIMER1_PRESCALER)    // 2,000,000 at 16 MHz
+// Timer1 prescaler = 1 => 16 MHz on 16 MHz boards.
+#define TIMER1_PRESCALER    1UL
+#define TIMER1_CLK_HZ     (F_CPU / TIMER1_PRESCALER)    // 16,000,000 at 16 MHz
+
+// Minimum gate time in ticks, a gate closes at the first edge after it (2 ms).
+#define GATE_TICKS      32768UL
 
 // Expected frequency band (used for sanity checks).
 #define FREQ_MIN_HZ     30.0f
 #define FREQ_MAX_HZ     10000.0f
 
 // Derived tick bounds for the valid band.
-#define TICKS_MIN     (uint32_t)( (float)TIMER1_CLK_HZ / FREQ_MAX_HZ )    // ~200 ticks @10 kHz
-#define TICKS_MAX     (uint32_t)( (float)TIMER1_CLK_HZ / FREQ_MIN_HZ )    // ~66666 ticks @30 Hz
+#define TICKS_MIN     (uint32_t)( (float)TIMER1_CLK_HZ / FREQ_MAX_HZ )    // ~1600 ticks @10 kHz
+#define TICKS_MAX     (uint32_t)( (float)TIMER1_CLK_HZ / FREQ_MIN_HZ )    // ~533333 ticks @30 Hz
+
+// Capture timestamp ring, power of 2: 6.4 ms of edges at 10 kHz between two freq_read().
+#define CAPTURE_RING_SIZE   64
+#define CAPTURE_RING_MASK   (CAPTURE_RING_SIZE - 1)
+
+// Periods in the running median for the outlier rejection.
+#define MEDIAN_PERIODS      5
 
 // Milliseconds without new captures before reporting NAN.
 #define NO_SIGNAL_TIMEOUT_MS    120U
 
-// EMA smoothing (alpha = 1/4, integer-friendly).
-#define EMA_NUM     1
-#define EMA_DEN     4
-
 // Enable input-capture noise canceler (adds ~0.25 µs qualification).
 #define USE_NOISE_CANCELER    1
 
 // ====================== Module state ===========================================
 
-// Extended timebase: overflow count + ICR1 latched at the ISR.
+// Extended timebase: overflow count, kept by the overflow ISR.
 static volatile uint16_t s_ovf = 0;
-static volatile uint32_t s_icr32 = 0;
-static volatile bool     s_newCap = false;
 
-// Last processed capture (extended) in the foreground.
-static uint32_t s_prevIcr32 = 0;
+// Extended capture timestamps, written by the ISR at s_ringHead, read at s_ringTail.
+static volatile uint32_t s_ring[CAPTURE_RING_SIZE];
+static volatile uint8_t  s_ringHead = 0;
+static volatile uint8_t  s_ringTail = 0;
+static volatile uint16_t s_overruns = 0;    // edges dropped on a full ring
+
+// Foreground period processing.
+static uint32_t s_prevCap = 0;
+static bool     s_havePrev = false;
+static uint32_t s_history[MEDIAN_PERIODS];  // last in-band periods for the median
+static uint8_t  s_historyCount = 0;
+static uint8_t  s_historyIndex = 0;
+static uint32_t s_gateTicks = 0;            // accepted ticks of the gate in progress
+static uint16_t s_gatePeriods = 0;
 
-// Smoothed frequency and raw (for debugging/telemetry).
-static float    s_freq_ema = NAN;
-static float    s_freq_raw = NAN;
+// Frequency of the last valid gate.
+static float    s_freq = NAN;
 
 // Last time we successfully updated a valid reading.
 static uint32_t s_lastOkMs = 0;
 
 // ====================== Public API =============================================
 
+#ifdef __AVR__
 /**
  * @brief Initialize Timer1 for input capture on D8 (ICP1).
  */
@@ -90,88 +117,140 @@ void freq_init() {
     // Clear any pending flags.
     TIFR1 = _BV(ICF1) | _BV(TOV1);
 
-    // Prescaler = 8, capture on rising edge, optional noise canceler.
+    // Prescaler = 1, capture on rising edge, optional noise canceler.
     TCCR1B =
 #if USE_NOISE_CANCELER
     _BV(ICNC1) |    // Input Capture Noise Canceler
 #endif
     _BV(ICES1)    |     // Capture on rising edge
-    _BV(CS11);    // clk/8
+    _BV(CS10);    // clk/1
 
     // Enable interrupts: Input Capture + Overflow.
     TIMSK1 = _BV(ICIE1) | _BV(TOIE1);
 
     s_ovf = 0;
-    s_icr32 = 0;
-    s_newCap = false;
-    s_prevIcr32 = 0;
-    s_freq_ema = NAN;
-    s_freq_raw = NAN;
+    s_ringHead = 0;
+    s_ringTail = 0;
+    s_overruns = 0;
+    s_havePrev = false;
+    s_historyCount = 0;
+    s_gateTicks = 0;
+    s_gatePeriods = 0;
+    s_freq = NAN;
     s_lastOkMs = millis();
 
     DEBUG_PRINTLN(F("Frequency measurement started."));
 }
+#endif // __AVR__
 
 /**
- * @brief Read current frequency in Hz (smoothed). Returns NAN if signal missing/out of range.
- * @return float Frequency in Hz (EMA), or NAN when no valid reading recently.
+ * @brief Median of the period history.
  */
-float freq_read() {
-    uint32_t cap = 0;
-    bool have = false;
-
-    // Atomically grab the latest capture (if any).
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-    if (s_newCap) {
-    cap = s_icr32;
-    s_newCap = false;
-    have = true;
-    }
+static uint32_t freq_median() {
+    uint32_t sorted[MEDIAN_PERIODS];
+    for (uint8_t i = 0; i < s_historyCount; i++) {
+        // insertion sort, at most MEDIAN_PERIODS entries
+        uint32_t v = s_history[i];
+        uint8_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
     }
+    return sorted[s_historyCount / 2];
+}
 
-    if (have) {
-        if (s_prevIcr32 == 0) {
-            // First capture seen: just prime the baseline.
-            s_prevIcr32 = cap;
-            // Keep existing EMA (likely NAN) until we have a full period.
-            return s_freq_ema;
+/**
+ * @brief Takes one period into the median and, if not an outlier, into the gate.
+ */
+static void freq_add_period(uint32_t ticks) {
+    // out-of-band: glitch, runt pulse or stall
+    if (ticks < TICKS_MIN || ticks > TICKS_MAX) { return; }
+
+    s_history[s_historyIndex] = ticks;
+    s_historyIndex = (s_historyIndex + 1) % MEDIAN_PERIODS;
+    if (s_historyCount < MEDIAN_PERIODS) { s_historyCount++; }
+
+    const uint32_t median = freq_median();
+    const uint32_t deviation = (ticks > median) ? ticks - median : median - ticks;
+    if (deviation > (median >> 3)) { return; }     // outlier, e.g. a lost edge doubles the period
+
+    s_gateTicks += ticks;
+    s_gatePeriods++;
+    if (s_gateTicks >= GATE_TICKS) {
+        const float f = (float)TIMER1_CLK_HZ * (float)s_gatePeriods / (float)s_gateTicks;
+        if (isfinite(f)) {
+            s_freq = f;
+            s_lastOkMs = millis();
         }
+        s_gateTicks = 0;
+        s_gatePeriods = 0;
+    }
+}
 
-        // Compute ticks between captures (handles wrap naturally with 32-bit).
-        const uint32_t ticks = cap - s_prevIcr32;
-        s_prevIcr32 = cap;
-
-        // Sanity checks to reject spurious captures.
-        if (ticks >= TICKS_MIN && ticks <= TICKS_MAX) {
-            const float f = (float)TIMER1_CLK_HZ / (float)ticks;
-
-            if (isfinite(f)) {
-                s_freq_raw = f;
-
-                // NaN-safe EMA: if EMA isn’t initialized, start from the first valid.
-                if (!isfinite(s_freq_ema)) {
-                    s_freq_ema = f;
-                } else {
-                    // ema += alpha*(f - ema); alpha = 1/4 => ema += (f-ema)/4
-                    s_freq_ema += (f - s_freq_ema) * ((float)EMA_NUM / (float)EMA_DEN);
-                }
-
-                s_lastOkMs = millis();
-            }
+/**
+ * @brief Read current frequency in Hz, averaged over the last gate.
+ *
+ * Drains all edges captured since the last call.
+ *
+ * @return float Frequency in Hz, 0 when no valid reading recently.
+ */
+float freq_read() {
+    uint8_t tail = s_ringTail;
+    while (tail != s_ringHead) {
+        const uint32_t cap = s_ring[tail];
+        tail = (tail + 1) & CAPTURE_RING_MASK;
+        s_ringTail = tail;      // hand the slot back to the ISR
+
+        if (s_havePrev) {
+            freq_add_period(cap - s_prevCap);   // handles wrap naturally with 32-bit
         }
-        // else: ignore out-of-band ticks (glitches / runt pulses / stalls)
+        s_prevCap = cap;
+        s_havePrev = true;
     }
 
-    // Timeout: if we haven’t seen a valid update recently, expose NAN to the caller.
+    // Timeout: if we haven’t seen a valid update recently, report no signal.
     if ((uint32_t)(millis() - s_lastOkMs) > NO_SIGNAL_TIMEOUT_MS) {
+        // start over, a new note must not be rejected against the old median
+        s_historyCount = 0;
+        s_gateTicks = 0;
+        s_gatePeriods = 0;
         return 0.f;
     }
 
-    return s_freq_ema;
+    return s_freq;
+}
+
+/**
+ * @brief Pushes a timestamp into the ring, on a full ring the edge is
+ * dropped and counted in s_overruns.
+ */
+static inline __attribute__((always_inline)) void freq_push(uint32_t cap) {
+    const uint8_t head = s_ringHead;
+    const uint8_t next = (head + 1) & CAPTURE_RING_MASK;
+    if (next == s_ringTail) {
+        s_overruns++;
+        return;
+    }
+    s_ring[head] = cap;
+    s_ringHead = next;
+}
+
+void freq_capture(uint32_t cap) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { freq_push(cap); }
+}
+
+uint16_t freq_overruns() {
+    uint16_t overruns;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { overruns = s_overruns; }
+    return overruns;
 }
 
 // ====================== ISRs ====================================================
 
+#ifdef __AVR__
+
 /**
  * @brief Timer1 Input Capture ISR.
  * Builds a 32-bit "extended capture" timestamp using the overflow counter.
@@ -179,6 +258,8 @@ float freq_read() {
  * Race-proofing vs. overflows: if TOV1 is set at the moment we read ICR1 and the
  * captured value is in the lower half, the edge likely happened after the overflow.
  * In that case, we attribute the capture to (ovf + 1).
+ *
+ * The timestamp is queued for freq_read() by freq_push().
  */
 ISR(TIMER1_CAPT_vect) {
     const uint16_t icr = ICR1;     // Latched at the edge
@@ -187,8 +268,7 @@ ISR(TIMER1_CAPT_vect) {
     // If an overflow occurred but hasn't been serviced yet AND the captured timer
     // value is in the "low" region, assign the capture to the post-overflow epoch.
     if ( (TIFR1 & _BV(TOV1)) && (icr < 0x8000) ) { ovf++; }
-    s_icr32 = ( (uint32_t)ovf << 16 ) | (uint32_t)icr;
-    s_newCap = true;
+    freq_push( ( (uint32_t)ovf << 16 ) | (uint32_t)icr );
 }
 
 /**
@@ -197,4 +277,6 @@ ISR(TIMER1_CAPT_vect) {
  */
 ISR(TIMER1_OVF_vect) {
     s_ovf++;
-}
\ No newline at end of file
+}
+
+#endif // __AVR__
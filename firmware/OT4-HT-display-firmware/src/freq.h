@@ -11,7 +11,7 @@
  * 
  */
 
-#include <Arduino.h>
+#include "../../platform.h"
 
 #ifndef _FREQUENCYMETER_H_
 #define _FREQUENCYMETER_H_
@@ -21,4 +21,14 @@ void freq_loop();
 
 float freq_read();
 
+/**
+ * @brief Queues one 32-bit extended capture timestamp (16 MHz ticks) for freq_read().
+ *
+ * Called by the input capture ISR, or by a host program replaying recorded timestamps.
+ */
+void freq_capture(uint32_t cap);
+
+/** @return number of edges dropped because the capture ring was full. */
+uint16_t freq_overruns();
+
 #endif // _FREQUENCYMETER_H_
\ No newline at end of file
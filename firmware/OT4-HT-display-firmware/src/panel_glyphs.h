@@ -0,0 +1,179 @@
+/* Tuner view glyphs in panel order - generated by scripts/gen_panel_glyphs.py from
+ * bitmap_fonts.h, do not edit. One byte per frame buffer byte (8 per module, row 0 first, MSB left).
+ */
+
+#include <Arduino.h>
+
+#ifndef _PANEL_GLYPHS_H_
+#define _PANEL_GLYPHS_H_
+
+#define PANEL_KEYBOARD_COLUMNS      28
+
+// keyboard view label (module 5): note * 3 + flat / natural / sharp, rows 4..7 bits 3..1 free for the octave
+const uint8_t panel_keyboard_label[21][8] PROGMEM = {
+    { 0x08, 0x6C, 0x8C, 0x80, 0x80, 0x80, 0x60, 0x00 }, /* 'Cb' */
+    { 0x00, 0x60, 0x80, 0x80, 0x80, 0x80, 0x60, 0x00 }, /* 'C ' */
+    { 0x0A, 0x64, 0x8A, 0x80, 0x80, 0x80, 0x60, 0x00 }, /* 'C#' */
+    { 0x08, 0xCC, 0xAC, 0xA0, 0xA0, 0xA0, 0xC0, 0x00 }, /* 'Db' */
+    { 0x00, 0xC0, 0xA0, 0xA0, 0xA0, 0xA0, 0xC0, 0x00 }, /* 'D ' */
+    { 0x0A, 0xC4, 0xAA, 0xA0, 0xA0, 0xA0, 0xC0, 0x00 }, /* 'D#' */
+    { 0x08, 0xEC, 0x8C, 0xE0, 0x80, 0x80, 0xE0, 0x00 }, /* 'Eb' */
+    { 0x00, 0xE0, 0x80, 0xE0, 0x80, 0x80, 0xE0, 0x00 }, /* 'E ' */
+    { 0x0A, 0xE4, 0x8A, 0xE0, 0x80, 0x80, 0xE0, 0x00 }, /* 'E#' */
+    { 0x08, 0xEC, 0x8C, 0xC0, 0x80, 0x80, 0x80, 0x00 }, /* 'Fb' */
+    { 0x00, 0xE0, 0x80, 0xC0, 0x80, 0x80, 0x80, 0x00 }, /* 'F ' */
+    { 0x0A, 0xE4, 0x8A, 0xC0, 0x80, 0x80, 0x80, 0x00 }, /* 'F#' */
+    { 0x08, 0x6C, 0x8C, 0x80, 0xA0, 0xA0, 0x60, 0x00 }, /* 'Gb' */
+    { 0x00, 0x60, 0x80, 0x80, 0xA0, 0xA0, 0x60, 0x00 }, /* 'G ' */
+    { 0x0A, 0x64, 0x8A, 0x80, 0xA0, 0xA0, 0x60, 0x00 }, /* 'G#' */
+    { 0x08, 0x4C, 0xAC, 0xA0, 0xE0, 0xA0, 0xA0, 0x00 }, /* 'Ab' */
+    { 0x00, 0x40, 0xA0, 0xA0, 0xE0, 0xA0, 0xA0, 0x00 }, /* 'A ' */
+    { 0x0A, 0x44, 0xAA, 0xA0, 0xE0, 0xA0, 0xA0, 0x00 }, /* 'A#' */
+    { 0x08, 0xCC, 0xAC, 0xC0, 0xA0, 0xA0, 0xC0, 0x00 }, /* 'Bb' */
+    { 0x00, 0xC0, 0xA0, 0xC0, 0xA0, 0xA0, 0xC0, 0x00 }, /* 'B ' */
+    { 0x0A, 0xC4, 0xAA, 0xC0, 0xA0, 0xA0, 0xC0, 0x00 }, /* 'B#' */
+};
+
+// keyboard view cursor: label glyph, frame buffer index and byte of row 6 with the cursor pixel
+typedef struct {
+    uint8_t label;      // panel_keyboard_label index
+    uint8_t index;      // frame buffer index of the cursor row
+    uint8_t cursor;     // font_keyboard byte at index with the cursor pixel toggled
+} panel_keyboard_column_t;
+
+const panel_keyboard_column_t panel_keyboard_column[PANEL_KEYBOARD_COLUMNS] PROGMEM = {
+    { 20,  6, 0x08 }, /* column  0 */
+    {  0,  6, 0xC8 }, /* column  1 */
+    {  1,  6, 0xA8 }, /* column  2 */
+    {  2,  6, 0x98 }, /* column  3 */
+    {  2,  6, 0x80 }, /* column  4 */
+    {  3,  6, 0x8C }, /* column  5 */
+    {  4,  6, 0x8A }, /* column  6 */
+    {  5,  6, 0x89 }, /* column  7 */
+    {  5, 14, 0x08 }, /* column  8 */
+    {  6, 14, 0xC8 }, /* column  9 */
+    {  7, 14, 0xA8 }, /* column 10 */
+    {  8, 14, 0x98 }, /* column 11 */
+    {  8, 14, 0x80 }, /* column 12 */
+    {  9, 14, 0x8C }, /* column 13 */
+    { 10, 14, 0x8A }, /* column 14 */
+    { 11, 14, 0x89 }, /* column 15 */
+    { 11, 22, 0x08 }, /* column 16 */
+    { 12, 22, 0xC8 }, /* column 17 */
+    { 13, 22, 0xA8 }, /* column 18 */
+    { 14, 22, 0x98 }, /* column 19 */
+    { 14, 22, 0x80 }, /* column 20 */
+    { 15, 22, 0x8C }, /* column 21 */
+    { 16, 22, 0x8A }, /* column 22 */
+    { 17, 22, 0x89 }, /* column 23 */
+    { 17, 30, 0x08 }, /* column 24 */
+    { 18, 30, 0xC8 }, /* column 25 */
+    { 19, 30, 0xA8 }, /* column 26 */
+    { 20, 30, 0x98 }, /* column 27 */
+};
+
+// two-digit numbers of font_small_numbers, 5 rows
+const uint8_t panel_small_numbers_2[100][5] PROGMEM = {
+    { 0x22, 0x55, 0x55, 0x55, 0x22 }, /* 00 */
+    { 0x22, 0x56, 0x52, 0x52, 0x27 }, /* 01 */
+    { 0x26, 0x51, 0x52, 0x54, 0x27 }, /* 02 */
+    { 0x26, 0x51, 0x53, 0x51, 0x26 }, /* 03 */
+    { 0x21, 0x53, 0x55, 0x57, 0x21 }, /* 04 */
+    { 0x27, 0x54, 0x57, 0x51, 0x26 }, /* 05 */
+    { 0x23, 0x54, 0x57, 0x55, 0x27 }, /* 06 */
+    { 0x27, 0x51, 0x52, 0x52, 0x22 }, /* 07 */
+    { 0x27, 0x55, 0x57, 0x55, 0x27 }, /* 08 */
+    { 0x27, 0x55, 0x57, 0x51, 0x26 }, /* 09 */
+    { 0x22, 0x65, 0x25, 0x25, 0x72 }, /* 10 */
+    { 0x22, 0x66, 0x22, 0x22, 0x77 }, /* 11 */
+    { 0x26, 0x61, 0x22, 0x24, 0x77 }, /* 12 */
+    { 0x26, 0x61, 0x23, 0x21, 0x76 }, /* 13 */
+    { 0x21, 0x63, 0x25, 0x27, 0x71 }, /* 14 */
+    { 0x27, 0x64, 0x27, 0x21, 0x76 }, /* 15 */
+    { 0x23, 0x64, 0x27, 0x25, 0x77 }, /* 16 */
+    { 0x27, 0x61, 0x22, 0x22, 0x72 }, /* 17 */
+    { 0x27, 0x65, 0x27, 0x25, 0x77 }, /* 18 */
+    { 0x27, 0x65, 0x27, 0x21, 0x76 }, /* 19 */
+    { 0x62, 0x15, 0x25, 0x45, 0x72 }, /* 20 */
+    { 0x62, 0x16, 0x22, 0x42, 0x77 }, /* 21 */
+    { 0x66, 0x11, 0x22, 0x44, 0x77 }, /* 22 */
+    { 0x66, 0x11, 0x23, 0x41, 0x76 }, /* 23 */
+    { 0x61, 0x13, 0x25, 0x47, 0x71 }, /* 24 */
+    { 0x67, 0x14, 0x27, 0x41, 0x76 }, /* 25 */
+    { 0x63, 0x14, 0x27, 0x45, 0x77 }, /* 26 */
+    { 0x67, 0x11, 0x22, 0x42, 0x72 }, /* 27 */
+    { 0x67, 0x15, 0x27, 0x45, 0x77 }, /* 28 */
+    { 0x67, 0x15, 0x27, 0x41, 0x76 }, /* 29 */
+    { 0x62, 0x15, 0x35, 0x15, 0x62 }, /* 30 */
+    { 0x62, 0x16, 0x32, 0x12, 0x67 }, /* 31 */
+    { 0x66, 0x11, 0x32, 0x14, 0x67 }, /* 32 */
+    { 0x66, 0x11, 0x33, 0x11, 0x66 }, /* 33 */
+    { 0x61, 0x13, 0x35, 0x17, 0x61 }, /* 34 */
+    { 0x67, 0x14, 0x37, 0x11, 0x66 }, /* 35 */
+    { 0x63, 0x14, 0x37, 0x15, 0x67 }, /* 36 */
+    { 0x67, 0x11, 0x32, 0x12, 0x62 }, /* 37 */
+    { 0x67, 0x15, 0x37, 0x15, 0x67 }, /* 38 */
+    { 0x67, 0x15, 0x37, 0x11, 0x66 }, /* 39 */
+    { 0x12, 0x35, 0x55, 0x75, 0x12 }, /* 40 */
+    { 0x12, 0x36, 0x52, 0x72, 0x17 }, /* 41 */
+    { 0x16, 0x31, 0x52, 0x74, 0x17 }, /* 42 */
+    { 0x16, 0x31, 0x53, 0x71, 0x16 }, /* 43 */
+    { 0x11, 0x33, 0x55, 0x77, 0x11 }, /* 44 */
+    { 0x17, 0x34, 0x57, 0x71, 0x16 }, /* 45 */
+    { 0x13, 0x34, 0x57, 0x75, 0x17 }, /* 46 */
+    { 0x17, 0x31, 0x52, 0x72, 0x12 }, /* 47 */
+    { 0x17, 0x35, 0x57, 0x75, 0x17 }, /* 48 */
+    { 0x17, 0x35, 0x57, 0x71, 0x16 }, /* 49 */
+    { 0x72, 0x45, 0x75, 0x15, 0x62 }, /* 50 */
+    { 0x72, 0x46, 0x72, 0x12, 0x67 }, /* 51 */
+    { 0x76, 0x41, 0x72, 0x14, 0x67 }, /* 52 */
+    { 0x76, 0x41, 0x73, 0x11, 0x66 }, /* 53 */
+    { 0x71, 0x43, 0x75, 0x17, 0x61 }, /* 54 */
+    { 0x77, 0x44, 0x77, 0x11, 0x66 }, /* 55 */
+    { 0x73, 0x44, 0x77, 0x15, 0x67 }, /* 56 */
+    { 0x77, 0x41, 0x72, 0x12, 0x62 }, /* 57 */
+    { 0x77, 0x45, 0x77, 0x15, 0x67 }, /* 58 */
+    { 0x77, 0x45, 0x77, 0x11, 0x66 }, /* 59 */
+    { 0x32, 0x45, 0x75, 0x55, 0x72 }, /* 60 */
+    { 0x32, 0x46, 0x72, 0x52, 0x77 }, /* 61 */
+    { 0x36, 0x41, 0x72, 0x54, 0x77 }, /* 62 */
+    { 0x36, 0x41, 0x73, 0x51, 0x76 }, /* 63 */
+    { 0x31, 0x43, 0x75, 0x57, 0x71 }, /* 64 */
+    { 0x37, 0x44, 0x77, 0x51, 0x76 }, /* 65 */
+    { 0x33, 0x44, 0x77, 0x55, 0x77 }, /* 66 */
+    { 0x37, 0x41, 0x72, 0x52, 0x72 }, /* 67 */
+    { 0x37, 0x45, 0x77, 0x55, 0x77 }, /* 68 */
+    { 0x37, 0x45, 0x77, 0x51, 0x76 }, /* 69 */
+    { 0x72, 0x15, 0x25, 0x25, 0x22 }, /* 70 */
+    { 0x72, 0x16, 0x22, 0x22, 0x27 }, /* 71 */
+    { 0x76, 0x11, 0x22, 0x24, 0x27 }, /* 72 */
+    { 0x76, 0x11, 0x23, 0x21, 0x26 }, /* 73 */
+    { 0x71, 0x13, 0x25, 0x27, 0x21 }, /* 74 */
+    { 0x77, 0x14, 0x27, 0x21, 0x26 }, /* 75 */
+    { 0x73, 0x14, 0x27, 0x25, 0x27 }, /* 76 */
+    { 0x77, 0x11, 0x22, 0x22, 0x22 }, /* 77 */
+    { 0x77, 0x15, 0x27, 0x25, 0x27 }, /* 78 */
+    { 0x77, 0x15, 0x27, 0x21, 0x26 }, /* 79 */
+    { 0x72, 0x55, 0x75, 0x55, 0x72 }, /* 80 */
+    { 0x72, 0x56, 0x72, 0x52, 0x77 }, /* 81 */
+    { 0x76, 0x51, 0x72, 0x54, 0x77 }, /* 82 */
+    { 0x76, 0x51, 0x73, 0x51, 0x76 }, /* 83 */
+    { 0x71, 0x53, 0x75, 0x57, 0x71 }, /* 84 */
+    { 0x77, 0x54, 0x77, 0x51, 0x76 }, /* 85 */
+    { 0x73, 0x54, 0x77, 0x55, 0x77 }, /* 86 */
+    { 0x77, 0x51, 0x72, 0x52, 0x72 }, /* 87 */
+    { 0x77, 0x55, 0x77, 0x55, 0x77 }, /* 88 */
+    { 0x77, 0x55, 0x77, 0x51, 0x76 }, /* 89 */
+    { 0x72, 0x55, 0x75, 0x15, 0x62 }, /* 90 */
+    { 0x72, 0x56, 0x72, 0x12, 0x67 }, /* 91 */
+    { 0x76, 0x51, 0x72, 0x14, 0x67 }, /* 92 */
+    { 0x76, 0x51, 0x73, 0x11, 0x66 }, /* 93 */
+    { 0x71, 0x53, 0x75, 0x17, 0x61 }, /* 94 */
+    { 0x77, 0x54, 0x77, 0x11, 0x66 }, /* 95 */
+    { 0x73, 0x54, 0x77, 0x15, 0x67 }, /* 96 */
+    { 0x77, 0x51, 0x72, 0x12, 0x62 }, /* 97 */
+    { 0x77, 0x55, 0x77, 0x15, 0x67 }, /* 98 */
+    { 0x77, 0x55, 0x77, 0x11, 0x66 }, /* 99 */
+};
+
+#endif // _PANEL_GLYPHS_H_
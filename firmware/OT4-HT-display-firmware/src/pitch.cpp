@@ -0,0 +1,162 @@
+/**
+ * @file pitch.cpp
+ * @brief fixed-point frequency to 12-TET note analysis, without logf()
+ * 
+ * GNU GPL v3 or later.
+ * 
+ */
+
+#include "pitch.h"
+#include "../../build_options.h"
+#include <math.h>
+
+#define PITCH_FREQ_SHIFT    12  // frequency in 1/4096 Hz, inputs up to 64 kHz
+#define LOG2_TABLE_BITS     6   // 64 segments per octave
+#define LOG2_FRAC_BITS      (16 - LOG2_TABLE_BITS)
+
+// log2(1 + i/64) in 0.16 fixed point, i = 0..63: round(log2(1 + i / 64.0) * 65536)
+static const uint16_t PROGMEM log2_table[1 << LOG2_TABLE_BITS] = {
+        0,  1466,  2909,  4331,  5732,  7112,  8473,  9814,
+    11136, 12440, 13727, 14996, 16248, 17484, 18704, 19909,
+    21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+    30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346,
+    38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+    45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063,
+    52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643,
+    59434, 60219, 60997, 61769, 62534, 63294, 64047, 64794,
+};
+
+int32_t pitch_log2(uint32_t x) {
+    if (x == 0) { return 0; }
+
+    // integer part: position of the highest set bit
+    uint8_t e = 31;
+    while (!(x & 0x80000000UL)) {
+        x <<= 1;
+        e--;
+    }
+
+    // x is now 1.31, take 6 bits of table index and 10 bits to interpolate
+    const uint8_t  i    = (uint8_t)(x >> (31 - LOG2_TABLE_BITS)) & ((1 << LOG2_TABLE_BITS) - 1);
+    const uint16_t frac = (uint16_t)(x >> (31 - 16)) & ((1 << LOG2_FRAC_BITS) - 1);
+    const uint16_t y0   = pgm_read_word(&log2_table[i]);
+    const uint32_t y1   = (i == (1 << LOG2_TABLE_BITS) - 1) ? 65536UL : pgm_read_word(&log2_table[i + 1]);
+
+    return ((int32_t)e << 16) + y0 + (int32_t)(((y1 - y0) * frac) >> LOG2_FRAC_BITS);
+}
+
+const pitch_t* pitch_analyze(float freq, float concert_a) {
+    static pitch_t result = { false, 0, 0, 0 };
+    static uint32_t last_freq = 0;
+    static float last_ref = 0.0f;
+    static int32_t log2_ref = 0;        // log2(concert_a) - log2(MIDI note 69), 16.16
+
+    if (!isfinite(concert_a) || concert_a <= 0.0f) {
+        concert_a = 440.0f; // safe default
+    }
+    const uint32_t f = (isfinite(freq) && freq > 0.0f && freq < 65536.0f)
+                     ? (uint32_t)(freq * (1UL << PITCH_FREQ_SHIFT) + 0.5f) : 0;
+
+    if (f == last_freq && concert_a == last_ref) {
+        return &result;
+    }
+
+    if (concert_a != last_ref) {
+        last_ref = concert_a;
+        log2_ref = pitch_log2((uint32_t)(concert_a * (1UL << PITCH_FREQ_SHIFT) + 0.5f));
+    }
+    last_freq = f;
+
+    // cents above MIDI note 0: 6900 + 1200 * log2(freq / A4)
+    const int32_t octaves = pitch_log2(f) - log2_ref;   // 16.16, same scale on both sides
+    const int32_t midi_cents = 6900 + (int32_t)((octaves * 1200 + 32768) >> 16);
+
+    if (f == 0 || midi_cents < 0) {
+        result.valid = false;
+        result.midi_note = 0;
+        result.cents = 0;
+        result.midi_cents = 0;
+        return &result;
+    }
+
+    result.valid = true;
+    result.midi_cents = (uint32_t)midi_cents;
+    result.midi_note = (int16_t)((result.midi_cents + 50) / 100);
+    result.cents = (int8_t)(midi_cents - (int32_t)result.midi_note * 100);
+    return &result;
+}
+
+/**
+ * @brief Convert a raw frequency to its closest equal temperament (12-TET) note name.
+ * 
+ * This function maps a given input frequency to the nearest musical note 
+ * based on the 12-tone equal temperament system. It allows for a custom 
+ * concert pitch (e.g., A4 = 440 Hz or 432 Hz) and provides both the MIDI 
+ * note number and the cent deviation from the closest equal-tempered note.
+ * 
+ * @param freq
+ *        The input frequency in Hz (must be > 0).
+ * 
+ * @param pitch_concert_a
+ *        The reference pitch for A4 in Hz (typically 440.0f, but can be set 
+ *        to alternate standards like 432.0f).
+ * 
+ * @param cent_drift
+ *        Pointer to a float where the function stores the cent deviation 
+ *        from the nearest equal-tempered note. Positive values mean the 
+ *        frequency is sharp, negative means flat. Pass NULL to ignore.
+ * 
+ * @param midi_note
+ *        Pointer to an int where the function stores the MIDI note number 
+ *        (e.g., 69 for A4). Pass NULL to ignore.
+ * 
+ * @return const char*
+ *         A pointer to a static string containing the note name and octave, 
+ *         e.g., "A4", "C#3", "B-1". The string is stored in static memory 
+ *         and will be overwritten by subsequent calls.
+ */
+const char* pitch_frequency_to_note(float freq, float pitch_concert_a, float* cent_drift, int16_t* midi_note) {
+    const pitch_t* pitch = pitch_analyze(freq, pitch_concert_a);
+    if (!pitch->valid) {
+        if (cent_drift) *cent_drift = 0;
+        if (midi_note)  *midi_note  = 0;
+        return "";
+    }
+
+    static const char* note_names[] = {
+        "C ", "C#", "D ", "D#", "E ", "F ", "F#", "G ", "G#", "A ", "A#", "B "
+    };
+
+    // nearest note and cents drift in [-50..+49] come from the shared fixed-point analysis
+    const int16_t midi_i = pitch->midi_note;
+    const uint8_t note_index = (uint8_t)(midi_i % 12);     // midi_i >= 0
+    const int8_t  octave     = (int8_t)(midi_i / 12 - 1);
+
+    if (cent_drift) *cent_drift = pitch->cents;
+    if (midi_note)  *midi_note  = midi_i;
+
+    // Compose "<note><octave>" into a small static buffer (thread-unsafe by design).
+    // Max we expect: "A 10" (4 chars) or "C#-1" (4 chars). Buffer of 6 is plenty.
+    static char result[6];
+    result[0] = note_names[note_index][0];
+    result[1] = note_names[note_index][1];
+
+    // Write octave as [-1..10] typical; supports two digits and sign.
+    int idx = 2;
+    int8_t o = octave;
+    if (o < 0) {
+        result[idx++] = '-';
+        o = (int8_t)(-o);
+    }
+    if (o >= 10) {
+        result[idx++] = '1';
+        o = (int8_t)(o - 10);
+    }
+    result[idx++] = (char)('0' + o);
+    result[idx]   = '\0';
+
+    DEBUG_PRINT("freq=");DEBUG_PRINT(freq);
+    DEBUG_PRINT(" ");DEBUG_PRINT(result);DEBUG_PRINT(" ");
+    DEBUG_PRINT(pitch->cents);DEBUG_PRINT(" cents MIDI=");DEBUG_PRINTLN(midi_i);
+    return result;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file pitch.h
+ * @brief fixed-point frequency to 12-TET note analysis, without logf()
+ * 
+ * GNU GPL v3 or later.
+ * 
+ */
+
+#include "../../platform.h"
+
+#ifndef _PITCH_H_
+#define _PITCH_H_
+
+/**
+ * @brief Note analysis of one frequency, shared by all tuner views.
+ */
+typedef struct {
+    bool     valid;         /**< false below MIDI note 0 (8.18 Hz) or for non-finite input */
+    int16_t  midi_note;     /**< nearest equal-tempered note, 69 = A4 */
+    int8_t   cents;         /**< drift from midi_note, -50..+49 */
+    uint32_t midi_cents;    /**< pitch in cents above MIDI note 0 (C-1) */
+} pitch_t;
+
+/**
+ * @brief log2 of an unsigned value.
+ * @return log2(x) as 16.16 fixed point (0 for x == 0), error below 0.0001 octave.
+ */
+int32_t pitch_log2(uint32_t x);
+
+/**
+ * @brief Analyze a frequency against the concert A reference.
+ *
+ * The result is cached: as long as the frequency (at 1/4096 Hz resolution)
+ * and the reference stay the same, the previous analysis is returned.
+ *
+ * @param freq       frequency in Hz
+ * @param concert_a  reference pitch of A4 in Hz (440 Hz if not valid)
+ * @return pointer to the static analysis, overwritten by the next call
+ */
+const pitch_t* pitch_analyze(float freq, float concert_a);
+
+/**
+ * @brief Note name, MIDI note and cents drift of a frequency, see pitch_analyze().
+ * @return "<note><octave>" in a static buffer, e.g. "A 4", "C#-1", "" if not valid
+ */
+const char* pitch_frequency_to_note(float freq, float pitch_concert_a, float* cent_drift, int16_t* midi_note);
+
+#endif // _PITCH_H_
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+"""
+@file gen_quantizer_notes.py
+@brief Generates the PROGMEM note table of the pitch quantizer.
+
+Writes ../src/quantizer_notes.h: the DDS phase increment of every equal-tempered
+MIDI note at A4 = CONCERT_A Hz, from note 0 up to the last one below the
+highest increment of the wave generator (16383).
+The increments are stored with NOTE_FRACTION_BITS fractional bits, the lowest
+notes are only some 17 increments apart from each other.
+
+  f = increment * SAMPLE_RATE / 65536 Hz, see LINK_FRAME_STATUS in link_protocol.h
+
+quantizer.cpp scales its input to A4 = CONCERT_A, so the table serves any concert A.
+
+usage: python3 gen_quantizer_notes.py   (no external dependencies)
+
+(c) GNU GPL v3 or later.
+"""
+
+import os
+
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "quantizer_notes.h")
+
+CONCERT_A = 440
+SAMPLE_RATE = 31250.0
+NOTE_FRACTION_BITS = 2
+INCREMENT_MAX = 16383
+
+
+def increment(note):
+    f = CONCERT_A * 2 ** ((note - 69) / 12.0)
+    return f * 65536 / SAMPLE_RATE
+
+
+def main():
+    notes = []
+    note = 0
+    while increment(note) <= INCREMENT_MAX:
+        notes.append(int(round(increment(note) * (1 << NOTE_FRACTION_BITS))))
+        note += 1
+    assert notes[-1] <= 0xFFFF
+
+    out = ["/* Pitch quantizer notes - generated by scripts/gen_quantizer_notes.py, do not edit.",
+           " * index: MIDI note, value: DDS phase increment at A4 = %d Hz, %d fractional bits" %
+           (CONCERT_A, NOTE_FRACTION_BITS),
+           " */",
+           "",
+           "#ifndef QUANTIZER_NOTES_H",
+           "#define QUANTIZER_NOTES_H",
+           "",
+           "#include <avr/pgmspace.h>",
+           "",
+           "#define QUANTIZER_NOTES                 %d" % len(notes),
+           "#define QUANTIZER_NOTES_CONCERT_A       %d" % CONCERT_A,
+           "#define QUANTIZER_NOTE_FRACTION_BITS    %d" % NOTE_FRACTION_BITS,
+           "",
+           "const uint16_t quantizer_notes[QUANTIZER_NOTES] PROGMEM = {"]
+    for i in range(0, len(notes), 8):
+        out.append("    " + " ".join("%5d," % v for v in notes[i:i + 8]))
+    out.append("};")
+    out.append("")
+    out.append("#endif // QUANTIZER_NOTES_H")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("quantizer_notes.h: %d notes, %d bytes" % (len(notes), 2 * len(notes)))
+
+
+if __name__ == "__main__":
+    main()
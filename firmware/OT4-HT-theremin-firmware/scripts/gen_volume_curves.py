@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+@file gen_volume_curves.py
+@brief Generates the PROGMEM volume response curves.
+
+Writes ../src/volume_curves.h: one 256-entry uint16 table per curve, indexed by
+the clamped 8-bit volume of loop(), giving the 16-bit vScaledVolume of the ISR.
+
+  0 pseudo-exponential  c * (c + 2), the original OpenTheremin response
+  1 exponential         VOLUME_EXP_RANGE_DB of dynamic range
+  2 linear              c * 257
+  3 custom              USER_CURVE points below, linearly interpolated
+
+usage: python3 gen_volume_curves.py   (no external dependencies)
+
+(c) GNU GPL v3 or later.
+"""
+
+import os
+
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "volume_curves.h")
+
+VOLUME_EXP_RANGE_DB = 48.0
+
+# custom curve: (input 0..255, output 0..65535) breakpoints, edit to taste
+USER_CURVE = [(0, 0), (32, 600), (96, 8000), (160, 30000), (224, 58000), (255, 65535)]
+
+
+def pseudo_exponential(c):
+    return c * (c + 2)
+
+
+def exponential(c):
+    if c == 0:
+        return 0
+    db = (c / 255.0 - 1.0) * VOLUME_EXP_RANGE_DB
+    return int(round(65535 * 10 ** (db / 20.0)))
+
+
+def linear(c):
+    return c * 257
+
+
+def custom(c):
+    for (x0, y0), (x1, y1) in zip(USER_CURVE, USER_CURVE[1:]):
+        if x0 <= c <= x1:
+            return int(round(y0 + (y1 - y0) * (c - x0) / float(x1 - x0)))
+    raise ValueError("USER_CURVE must cover 0..255")
+
+
+CURVES = [
+    ("pseudo-exponential c * (c + 2)", pseudo_exponential),
+    ("exponential, %g dB range" % VOLUME_EXP_RANGE_DB, exponential),
+    ("linear c * 257", linear),
+    ("custom user curve", custom),
+]
+
+
+def main():
+    out = ["/* Theremin volume curves - generated by scripts/gen_volume_curves.py, do not edit.",
+           " * index: clamped 8-bit volume, value: vScaledVolume (0..65535)",
+           " */",
+           "",
+           "#ifndef VOLUME_CURVES_H",
+           "#define VOLUME_CURVES_H",
+           "",
+           "#include <avr/pgmspace.h>",
+           "",
+           "#define VOLUME_CURVES_COUNT %d" % len(CURVES),
+           "",
+           "const uint16_t volume_curves[VOLUME_CURVES_COUNT][256] PROGMEM = {"]
+    for name, fn in CURVES:
+        values = [min(65535, max(0, fn(c))) for c in range(256)]
+        out.append("    { // %s" % name)
+        for i in range(0, 256, 8):
+            out.append("        " + " ".join("%5d," % v for v in values[i:i + 8]))
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    out.append("#endif // VOLUME_CURVES_H")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("volume_curves.h: %d curves, %d bytes" % (len(CURVES), len(CURVES) * 512))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+"""
+@file gen_wavetable_compressed.py
+@brief Generates the compressed wavetable set for WAVEFORM_COMPRESSED.
+
+Reads the 1024-point wavetable_N.h tables from ../src, adds a set of
+synthesized timbres and writes ../src/wavetable_compressed.h (PROGMEM).
+Every table is stored in the smallest of these lossless formats:
+
+  QUARTER   s[512 - i] == s[i] and s[i + 512] == -s[i]:
+            samples 0..256 only                                   514 bytes
+  HALF      s[i + 512] == -s[i]: samples 0..511 only             1024 bytes
+  BLOCK8    one int16 base per 8 samples + one int8 offset
+            per sample, if every sample is within -128..127
+            of its block base                                    1280 bytes
+  PACKED12  two 12-bit offset-binary samples in 3 bytes          1536 bytes
+
+The decoder in ihandlers.cpp (wavetable_compressed_read()) maps a 10-bit
+table index to a sample with at most two PROGMEM reads per format.
+
+The synthesized timbres are band-limited additive waveforms (sine phase).
+Odd-harmonic recipes are built from their first quarter and mirrored, so they
+are exactly quarter-wave symmetric; other recipes get the full table.
+
+usage: python3 gen_wavetable_compressed.py   (no external dependencies)
+
+(c) GNU GPL v3 or later.
+"""
+
+import math
+import os
+
+from gen_wavetable_mipmaps import read_table, SRC_DIR, BASE_LENGTH, FLASH_SIZE
+
+OUTPUT = "wavetable_compressed.h"
+
+HALF_LENGTH = BASE_LENGTH // 2
+QUARTER_LENGTH = BASE_LENGTH // 4
+BLOCK = 8
+AMPLITUDE_PEAK = 2047
+
+FORMATS = ["QUARTER", "HALF", "BLOCK8", "PACKED12"]
+
+# shipped tables: (header file, table symbol), played in this order
+SHIPPED = [("wavetable_%d.h" % n, "wavetable_%d" % n) for n in range(8)] + \
+          [("wavetable_pure_sine1024.h", "wavetable_sine1024")]
+
+# synthesized timbres: (symbol, {harmonic: amplitude}), sine phase.
+# odd harmonics only, so they fold to QUARTER tables (514 bytes each)
+SYNTHESIZED = [
+    ("wavetable_triangle", {k: (-1) ** ((k - 1) // 2) / k ** 2 for k in range(1, 16, 2)}),
+    ("wavetable_square",   {k: 1.0 / k for k in range(1, 16, 2)}),
+    ("wavetable_clarinet", {1: 1.0, 3: 0.75, 5: 0.5, 7: 0.14, 9: 0.5, 11: 0.12, 13: 0.17}),
+    ("wavetable_hollow",   {1: 1.0, 3: 0.5, 5: 0.25}),
+    ("wavetable_flute",    {1: 1.0, 3: 0.1, 5: 0.03}),
+    ("wavetable_oboe",     {1: 1.0, 3: 0.9, 5: 0.6, 7: 0.3, 9: 0.15}),
+    ("wavetable_bell",     {1: 1.0, 5: 0.6, 9: 0.4, 13: 0.3}),
+]
+
+
+def synthesize(recipe):
+    def value(i):
+        return sum(a * math.sin(2 * math.pi * k * i / BASE_LENGTH) for k, a in recipe.items())
+
+    odd = all(k % 2 for k in recipe)
+    count = QUARTER_LENGTH + 1 if odd else BASE_LENGTH
+    raw = [value(i) for i in range(count)]
+    peak = max(abs(v) for v in (raw if not odd else [value(i) for i in range(BASE_LENGTH)]))
+    samples = [int(round(v * AMPLITUDE_PEAK / peak)) for v in raw]
+    if odd:
+        # mirror the first quarter: exactly quarter-wave symmetric
+        half = samples + [samples[HALF_LENGTH - i] for i in range(QUARTER_LENGTH + 1, HALF_LENGTH)]
+        samples = half + [-v for v in half]
+    return samples
+
+
+def is_half(s):
+    return all(s[i + HALF_LENGTH] == -s[i] for i in range(HALF_LENGTH))
+
+
+def is_quarter(s):
+    return is_half(s) and all(s[HALF_LENGTH - i] == s[i] for i in range(1, HALF_LENGTH))
+
+
+def block_bases(s):
+    """int16 base per block (middle of its range), None if an offset does not fit int8."""
+    bases = []
+    for b in range(0, BASE_LENGTH, BLOCK):
+        lo, hi = min(s[b:b + BLOCK]), max(s[b:b + BLOCK])
+        base = (lo + hi + 1) // 2
+        if lo - base < -128 or hi - base > 127:
+            return None
+        bases.append(base)
+    return bases
+
+
+def choose_format(s):
+    if is_quarter(s):
+        return "QUARTER"
+    if is_half(s):
+        return "HALF"
+    if block_bases(s) is not None:
+        return "BLOCK8"
+    if min(s) < -2048 or max(s) > 2047:
+        raise ValueError("sample range exceeds 12 bits")
+    return "PACKED12"
+
+
+def format_rows(values, width):
+    return ["    " + " ".join(("%" + str(width) + "d,") % v for v in values[i:i + 8])
+            for i in range(0, len(values), 8)]
+
+
+def encode(symbol, s, fmt):
+    """C definitions and size in bytes of one table."""
+    lines = []
+    if fmt == "QUARTER":
+        data = s[:QUARTER_LENGTH + 1]
+        lines.append("const int16_t %s_q[%d] PROGMEM = {" % (symbol, len(data)))
+        lines += format_rows(data, 5)
+        size = 2 * len(data)
+        ref = ("WAVETABLE_FORMAT_QUARTER", "%s_q" % symbol, "NULL")
+    elif fmt == "HALF":
+        data = s[:HALF_LENGTH]
+        lines.append("const int16_t %s_h[%d] PROGMEM = {" % (symbol, len(data)))
+        lines += format_rows(data, 5)
+        size = 2 * len(data)
+        ref = ("WAVETABLE_FORMAT_HALF", "%s_h" % symbol, "NULL")
+    elif fmt == "BLOCK8":
+        bases = block_bases(s)
+        offsets = [s[i] - bases[i // BLOCK] for i in range(BASE_LENGTH)]
+        lines.append("const int16_t %s_base[%d] PROGMEM = {" % (symbol, len(bases)))
+        lines += format_rows(bases, 5)
+        lines.append("};")
+        lines.append("const int8_t %s_ofs[%d] PROGMEM = {" % (symbol, len(offsets)))
+        lines += format_rows(offsets, 4)
+        size = 2 * len(bases) + len(offsets)
+        ref = ("WAVETABLE_FORMAT_BLOCK8", "%s_base" % symbol, "%s_ofs" % symbol)
+    else:
+        raw = [v + 2048 for v in s]
+        packed = []
+        for i in range(0, BASE_LENGTH, 2):
+            a, b = raw[i], raw[i + 1]
+            packed += [a & 0xff, (a >> 8) | ((b & 0x0f) << 4), b >> 4]
+        packed += [0]   # pad: the decoder reads a word at the last odd sample
+        lines.append("const uint8_t %s_p12[%d] PROGMEM = {" % (symbol, len(packed)))
+        lines += format_rows(packed, 4)
+        size = len(packed)
+        ref = ("WAVETABLE_FORMAT_PACKED12", "%s_p12" % symbol, "NULL")
+    lines.append("};")
+    return lines, size, ref
+
+
+def main():
+    tables = [(symbol, read_table(filename)) for filename, symbol in SHIPPED]
+    tables += [(symbol, synthesize(recipe)) for symbol, recipe in SYNTHESIZED]
+
+    body = []
+    refs = []
+    budget = []
+    total = 0
+    for symbol, samples in tables:
+        fmt = choose_format(samples)
+        lines, size, ref = encode(symbol, samples, fmt)
+        body += lines + [""]
+        refs.append((symbol, ref))
+        budget.append(" *   %-22s %-9s %5d bytes" % (symbol, fmt, size))
+        total += size
+
+    out = []
+    out.append("/* Theremin WAVE Tables, compressed - generated by scripts/gen_wavetable_compressed.py, do not edit.")
+    out.append(" *")
+    out.append(" * FLASH BUDGET (ATmega328P, %d bytes available to the sketch)" % FLASH_SIZE)
+    out += budget
+    out.append(" *   descriptors            RAM       %5d bytes" % (5 * len(tables)))
+    out.append(" *   %d timbres                       %5d bytes, the 8 full tables alone take %d" %
+               (len(tables), total, 8 * BASE_LENGTH * 2))
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef WAVETABLE_COMPRESSED_H")
+    out.append("#define WAVETABLE_COMPRESSED_H")
+    out.append("")
+    out.append("#include <avr/pgmspace.h>")
+    out.append("")
+    for n, name in enumerate(FORMATS):
+        out.append("#define WAVETABLE_FORMAT_%-9s %d" % (name, n))
+    out.append("")
+    out.append("typedef struct {")
+    out.append("    uint8_t format;         // WAVETABLE_FORMAT_xxx")
+    out.append("    const void *data;       // samples, block bases or packed bytes in PROGMEM")
+    out.append("    const int8_t *offsets;  // WAVETABLE_FORMAT_BLOCK8 offsets in PROGMEM, NULL otherwise")
+    out.append("} wavetable_compressed_t;")
+    out.append("")
+    out += body
+    out.append("const wavetable_compressed_t wavetables[] = {")
+    for symbol, (fmt, data, offsets) in refs:
+        out.append("    { %s, %s, %s }," % (fmt, data, offsets))
+    out.append("};")
+    out.append("")
+    out.append("#endif // WAVETABLE_COMPRESSED_H")
+
+    with open(os.path.join(SRC_DIR, OUTPUT), "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("%s: %d timbres, %d bytes" % (OUTPUT, len(tables), total))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+@file gen_wavetable_mipmaps.py
+@brief Generates band-limited mip-map levels for the DDS wavetables.
+
+Reads the 1024-point wavetable_N.h tables from ../src, removes the harmonics
+each shorter level cannot play without aliasing, and writes
+../src/wavetable_mipmaps.h (PROGMEM, same -2048..2047 amplitude range).
+
+Level L holds 1024 >> L samples and keeps harmonics 1 .. (512 >> L) - 1.
+The DDS plays level L for phase increments up to 64 << L, so the highest kept
+harmonic always stays below the 15625 Hz Nyquist limit of the 31250 Hz SAMPLE_CLK.
+Levels below FIRST_LEVEL reuse the full 1024-point table to save flash.
+
+usage: python3 gen_wavetable_mipmaps.py   (no external dependencies)
+
+(c) GNU GPL v3 or later.
+"""
+
+import math
+import os
+
+SRC_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src")
+OUTPUT = "wavetable_mipmaps.h"
+
+BASE_LENGTH = 1024
+FIRST_LEVEL = 3     # 128 samples, 63 harmonics
+LAST_LEVEL = 7      # 8 samples, 3 harmonics (max. increment 8192, OCT+1 upper clamp)
+AMPLITUDE_MIN = -2048
+AMPLITUDE_MAX = 2047
+
+# (header file, table symbol, guard macro or None)
+TABLES = [("wavetable_pure_sine1024.h", "wavetable_sine1024", "WAVEFORM_INCLUDE_PURE_SINE")] + \
+         [("wavetable_%d.h" % n, "wavetable_%d" % n, None) for n in range(8)]
+
+FLASH_SIZE = 32768 - 512    # ATmega328P minus the optiboot bootloader
+
+
+def read_table(filename):
+    with open(os.path.join(SRC_DIR, filename)) as f:
+        text = f.read()
+    body = text[text.index("{") + 1:text.index("}")]
+    # evaluate each initializer like the compiler does (wavetable_6.h has "2\n-73" entries)
+    values = [eval(" ".join(v.split())) for v in body.split(",") if v.strip()]
+    if len(values) > BASE_LENGTH:
+        raise ValueError("%s: expected %d entries, got %d" % (filename, BASE_LENGTH, len(values)))
+    # missing trailing initializers are zero, as in C (wavetable_7.h has 1023)
+    return values + [0] * (BASE_LENGTH - len(values))
+
+
+def harmonics(samples, count):
+    """DFT coefficients (dc, [(re, im), ...]) of the first `count` harmonics."""
+    n = len(samples)
+    dc = sum(samples) / n
+    coeffs = []
+    for k in range(1, count + 1):
+        re_k = sum(s * math.cos(2 * math.pi * k * i / n) for i, s in enumerate(samples)) * 2 / n
+        im_k = sum(s * math.sin(2 * math.pi * k * i / n) for i, s in enumerate(samples)) * 2 / n
+        coeffs.append((re_k, im_k))
+    return dc, coeffs
+
+
+def synthesize(dc, coeffs, length):
+    out = []
+    for i in range(length):
+        v = dc
+        for k, (re_k, im_k) in enumerate(coeffs, start=1):
+            phi = 2 * math.pi * k * i / length
+            v += re_k * math.cos(phi) + im_k * math.sin(phi)
+        out.append(max(AMPLITUDE_MIN, min(AMPLITUDE_MAX, int(round(v)))))
+    return out
+
+
+def format_table(symbol, values):
+    lines = ["const int16_t %s[%d] PROGMEM = {" % (symbol, len(values))]
+    for i in range(0, len(values), 8):
+        lines.append("    " + " ".join("%5d," % v for v in values[i:i + 8]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    levels = list(range(FIRST_LEVEL, LAST_LEVEL + 1))
+    bytes_per_table = sum((BASE_LENGTH >> level) * 2 for level in levels)
+    out = []
+    out.append("/* Theremin WAVE Table mip-maps - generated by scripts/gen_wavetable_mipmaps.py, do not edit.")
+    out.append(" *")
+    out.append(" * level L: %s samples, harmonics 1..(512 >> L) - 1, played for increments <= 64 << L" %
+               "/".join(str(BASE_LENGTH >> level) for level in levels))
+    out.append(" * levels 0..%d reuse the full 1024-point table." % (FIRST_LEVEL - 1))
+    out.append(" *")
+    out.append(" * FLASH BUDGET (ATmega328P, %d bytes available to the sketch)" % FLASH_SIZE)
+    out.append(" *   full 1024-point tables       8 x 2048 = %5d bytes" % (8 * BASE_LENGTH * 2))
+    out.append(" *   mip-map levels %d..%d          8 x %4d = %5d bytes (+%d with WAVEFORM_INCLUDE_PURE_SINE)" %
+               (FIRST_LEVEL, LAST_LEVEL, bytes_per_table, 8 * bytes_per_table, bytes_per_table))
+    out.append(" *   mip-map pointer table        8 x %4d = %5d bytes" % (2 * len(levels), 8 * 2 * len(levels)))
+    out.append(" *   a full chain down from 512 points would instead cost 8 x %d = %d bytes," %
+               (sum((BASE_LENGTH >> l) * 2 for l in range(1, LAST_LEVEL + 1)),
+                8 * sum((BASE_LENGTH >> l) * 2 for l in range(1, LAST_LEVEL + 1))))
+    out.append(" *   which does not fit next to the full tables and the firmware.")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef WAVETABLE_MIPMAPS_H")
+    out.append("#define WAVETABLE_MIPMAPS_H")
+    out.append("")
+    out.append("#include <avr/pgmspace.h>")
+    out.append("")
+    out.append("#define WAVETABLE_MIPMAP_FIRST_LEVEL %d" % FIRST_LEVEL)
+    out.append("#define WAVETABLE_MIPMAP_LAST_LEVEL  %d" % LAST_LEVEL)
+    out.append("#define WAVETABLE_MIPMAP_LEVELS      %d" % len(levels))
+    out.append("")
+
+    for filename, symbol, guard in TABLES:
+        samples = read_table(filename)
+        dc, coeffs = harmonics(samples, (BASE_LENGTH >> FIRST_LEVEL) // 2 - 1)
+        if guard:
+            out.append("#ifdef %s" % guard)
+        for level in levels:
+            length = BASE_LENGTH >> level
+            table = synthesize(dc, coeffs[:length // 2 - 1], length)
+            out.append(format_table("%s_mip%d" % (symbol, level), table))
+        out.append("")
+        out.append("const int16_t *const %s_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {" % symbol)
+        out.append("    " + ", ".join("%s_mip%d" % (symbol, level) for level in levels))
+        out.append("};")
+        if guard:
+            out.append("#endif // %s" % guard)
+        out.append("")
+
+    out.append("#endif // WAVETABLE_MIPMAPS_H")
+    with open(os.path.join(SRC_DIR, OUTPUT), "w") as f:
+        f.write("\n".join(out) + "\n")
+    print("%s: %d levels, %d bytes per wavetable" % (OUTPUT, len(levels), bytes_per_table))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,63 @@
+#include "adc.h"
+#include "hw.h"
+
+static const uint8_t adc_channels[ADC_POT_COUNT] = { PITCH_POT, VOLUME_POT, REGISTER_SELECT_POT, WAVE_SELECT_POT };
+
+static int16_t adc_values[ADC_POT_COUNT];   // latest averaged reading per pot, 0..1023
+static uint8_t adc_pot = 0;                 // pot being converted
+static uint8_t adc_samples = 0;             // conversions of the current pot, the first one is discarded
+static uint16_t adc_sum = 0;
+
+static inline void adc_start(uint8_t pot) {
+    ADMUX = (1 << REFS0) | (adc_channels[pot] & 0x07);  // AVcc reference, select the pot channel
+    ADCSRA |= (1 << ADSC);
+}
+
+/**
+ * @brief Sets up the ADC and takes a first (blocking) reading of every pot.
+ *
+ * ADC clock 16 MHz / 128 = 125 kHz, 13 cycles = 104 us per conversion.
+ * The blocking scan only runs at power-on, so the pots are valid before the first loop().
+ */
+void adc_initialize() {
+    ADCSRA = (1 << ADEN) | (1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0);
+    for (uint8_t updated = 0; updated < ADC_POT_COUNT; ) {
+        if (adc_poll()) { updated++; }
+    }
+}
+
+/**
+ * @brief Advances the background scan of the pots, never waits for the ADC.
+ *
+ * The pots are converted one at a time, round-robin. The ADC is polled instead of using
+ * its conversion complete interrupt, so it adds no latency to ISR(INT1_vect).
+ * After a channel change the first conversion is discarded (sample and hold settling),
+ * the next 2^ADC_OVERSAMPLING_SHIFT are averaged into the reading of the pot.
+ *
+ * @return true when the reading of a pot has been updated.
+ */
+bool adc_poll() {
+    if (ADCSRA & (1 << ADSC)) { return false; }     // conversion running
+
+    bool updated = false;
+    if (adc_samples == 0) {
+        adc_samples++;                              // discard the first conversion after the channel change
+    } else {
+        adc_sum += ADC;
+        if (adc_samples == (1 << ADC_OVERSAMPLING_SHIFT)) {
+            adc_values[adc_pot] = adc_sum >> ADC_OVERSAMPLING_SHIFT;
+            adc_sum = 0;
+            adc_samples = 0;
+            adc_pot = (adc_pot + 1) % ADC_POT_COUNT;
+            updated = true;
+        } else {
+            adc_samples++;
+        }
+    }
+    adc_start(adc_pot);
+    return updated;
+}
+
+int16_t adc_value(uint8_t pot) {
+    return adc_values[pot];
+}
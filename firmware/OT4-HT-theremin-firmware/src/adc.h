@@ -0,0 +1,19 @@
+#include <Arduino.h>
+
+#ifndef _ADC_H_
+#define _ADC_H_
+
+// index of the potentiometers in the round-robin scan
+#define ADC_POT_PITCH           0
+#define ADC_POT_VOLUME          1
+#define ADC_POT_REGISTER        2
+#define ADC_POT_WAVE            3
+#define ADC_POT_COUNT           4
+
+#define ADC_OVERSAMPLING_SHIFT  2   // 2^2 = 4 conversions averaged per reading
+
+void adc_initialize();
+bool adc_poll();
+int16_t adc_value(uint8_t pot);
+
+#endif // _ADC_H_
@@ -0,0 +1,150 @@
+#include "benchmark.h"
+
+#ifdef ISR_BENCHMARK
+
+volatile uint32_t benchIsrCyclesSum = 0;
+volatile uint16_t benchIsrCyclesMin = 0xFFFF;
+volatile uint16_t benchIsrCyclesMax = 0;
+volatile uint16_t benchIsrSamples = 0;
+volatile uint16_t benchIsrOverruns = 0;
+volatile uint16_t benchIsrMissed = 0;
+volatile uint16_t benchSampleClock = 0;
+volatile uint16_t benchPitchStamp = 0;
+volatile uint16_t benchVolumeStamp = 0;
+
+/** Age of the values consumed by loop(), in SAMPLE_CLK ticks (32 us). */
+typedef struct {
+    uint32_t sum;
+    uint16_t count;
+    uint16_t max;
+} bench_age_t;
+
+/** Counters of the last complete report interval, printed by benchmark_print(). */
+typedef struct {
+    uint16_t samples;
+    uint16_t cyclesMin;
+    uint16_t cyclesAvg;
+    uint16_t cyclesMax;
+    uint16_t overruns;
+    uint16_t missed;
+    uint32_t loops;
+    bench_age_t pitch;
+    bench_age_t volume;
+} bench_report_t;
+
+static uint32_t benchLoopCount = 0;         // loop() iterations since the last report
+static bench_age_t benchPitchAge = { 0, 0, 0 };
+static bench_age_t benchVolumeAge = { 0, 0, 0 };
+static bench_report_t benchReport;
+static bool benchReportValid = false;
+
+static void benchmark_age(bench_age_t *age, volatile uint16_t *stamp) {
+    uint16_t now, then;
+    noInterrupts();
+    now = benchSampleClock;
+    then = *stamp;
+    interrupts();
+    uint16_t ticks = now - then;
+    age->sum += ticks;
+    age->count++;
+    if (ticks > age->max) { age->max = ticks; }
+}
+
+/**
+ * @brief Accounts the age of the pitch value taken by loop().
+ *
+ * Called where loop() consumes pitchValueAvailable: the ticks since ISR(INT1_vect)
+ * set it tell how long the value waited for the loop.
+ */
+void benchmark_pitch_used() {
+    benchmark_age(&benchPitchAge, &benchPitchStamp);
+}
+
+/** @brief Accounts the age of the volume value taken by loop(). */
+void benchmark_volume_used() {
+    benchmark_age(&benchVolumeAge, &benchVolumeStamp);
+}
+
+/**
+ * @brief Counts the main loop iterations and closes a report interval once per second.
+ *
+ * Called once per loop() iteration. After BENCHMARK_REPORT_SAMPLES SAMPLE_CLK ticks
+ * the counters are taken over atomically into the report printed by benchmark_print().
+ * Nothing is sent by itself, the UART is the display link.
+ */
+void benchmark_loop() {
+    benchLoopCount++;
+
+    bench_report_t r;
+    uint32_t sum;
+    noInterrupts();
+    r.samples = benchIsrSamples;
+    if (r.samples < BENCHMARK_REPORT_SAMPLES) {
+        interrupts();
+        return;
+    }
+    sum = benchIsrCyclesSum;
+    r.cyclesMin = benchIsrCyclesMin;
+    r.cyclesMax = benchIsrCyclesMax;
+    r.overruns = benchIsrOverruns;
+    r.missed = benchIsrMissed;
+    benchIsrCyclesSum = 0;
+    benchIsrCyclesMin = 0xFFFF;
+    benchIsrCyclesMax = 0;
+    benchIsrSamples = 0;
+    benchIsrOverruns = 0;
+    benchIsrMissed = 0;
+    interrupts();
+
+    r.cyclesAvg = sum / r.samples;
+    r.loops = benchLoopCount;
+    r.pitch = benchPitchAge;
+    r.volume = benchVolumeAge;
+    benchLoopCount = 0;
+    benchPitchAge = (bench_age_t){ 0, 0, 0 };
+    benchVolumeAge = (bench_age_t){ 0, 0, 0 };
+
+    benchReport = r;
+    benchReportValid = true;
+}
+
+static void benchmark_print_age(const __FlashStringHelper *name, const bench_age_t *age) {
+    Serial.print(name);
+    Serial.print(F(" age avg=")); Serial.print(age->count ? age->sum / age->count : 0);
+    Serial.print(F(" max=")); Serial.print(age->max);
+    Serial.print(F(" updates=")); Serial.println(age->count);
+}
+
+/**
+ * @brief Prints the last report interval, answer to STATE_CMD_DIAGNOSTICS:
+ *
+ *   ISR min=<cycles> avg=<cycles> max=<cycles> overruns=<count> missed=<count>
+ *   LOOP rate=<iterations> ticks=<samples>
+ *   PITCH age avg=<ticks> max=<ticks> updates=<count>
+ *   VOLUME age avg=<ticks> max=<ticks> updates=<count>
+ *
+ * ticks is the SAMPLE_CLK count of the interval (31250 = 1 s, a bit more if the loop
+ * was blocked), rate the number of loop() iterations within it.
+ * With a 512 cycle budget per sample, max must stay well below 512
+ * (minus the prologue/epilogue, see benchmark_isr_end()), overruns and missed at 0.
+ * The ages are in SAMPLE_CLK ticks (32 us) from the ISR setting the
+ * xxxValueAvailable flag to loop() using the value.
+ */
+void benchmark_print() {
+    if (!benchReportValid) {
+        Serial.println(F("ISR no report yet"));
+        return;
+    }
+    const bench_report_t r = benchReport;
+    Serial.print(F("ISR min=")); Serial.print(r.cyclesMin);
+    Serial.print(F(" avg=")); Serial.print(r.cyclesAvg);
+    Serial.print(F(" max=")); Serial.print(r.cyclesMax);
+    Serial.print(F(" overruns=")); Serial.print(r.overruns);
+    Serial.print(F(" missed=")); Serial.println(r.missed);
+    Serial.print(F("LOOP rate=")); Serial.print(r.loops);
+    Serial.print(F(" ticks=")); Serial.println(r.samples);
+    benchmark_print_age(F("PITCH"), &r.pitch);
+    benchmark_print_age(F("VOLUME"), &r.volume);
+}
+
+#endif // ISR_BENCHMARK
@@ -0,0 +1,67 @@
+#include <Arduino.h>
+#include "../../build_options.h"
+
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+#ifdef ISR_BENCHMARK
+
+#define BENCHMARK_ISR_DEADLINE_CYCLES   512     // 16 MHz / 31250 Hz SAMPLE_CLK = 32 us
+#define BENCHMARK_REPORT_SAMPLES        31250   // one report interval per second of SAMPLE_CLK ticks
+
+extern volatile uint32_t benchIsrCyclesSum;     // summed ISR(INT1_vect) durations in CPU cycles
+extern volatile uint16_t benchIsrCyclesMin;     // shortest ISR(INT1_vect) duration in CPU cycles
+extern volatile uint16_t benchIsrCyclesMax;     // longest ISR(INT1_vect) duration in CPU cycles
+extern volatile uint16_t benchIsrSamples;       // ISR(INT1_vect) runs since the last report
+extern volatile uint16_t benchIsrOverruns;      // runs longer than BENCHMARK_ISR_DEADLINE_CYCLES
+extern volatile uint16_t benchIsrMissed;        // runs that ended with the next SAMPLE_CLK already pending
+extern volatile uint16_t benchSampleClock;      // free-running SAMPLE_CLK count, time base of the update ages
+extern volatile uint16_t benchPitchStamp;       // benchSampleClock when pitchValueAvailable was set
+extern volatile uint16_t benchVolumeStamp;      // benchSampleClock when volumeValueAvailable was set
+
+/**
+ * @brief Start stamp of an ISR(INT1_vect) run, from the free-running 16 MHz Timer1.
+ */
+static inline __attribute__((always_inline)) uint16_t benchmark_isr_begin() {
+    return TCNT1;
+}
+
+/**
+ * @brief Accounts one ISR(INT1_vect) run started at the given Timer1 stamp.
+ *
+ * Timer1 runs at the CPU clock, so the difference is the cycle count of the ISR body.
+ * It doesn't include the compiler generated prologue/epilogue (register push/pop)
+ * and the interrupt entry, add roughly 40..60 cycles for the full cost.
+ *
+ * INTF1 still set here means the next SAMPLE_CLK edge came in while the ISR ran:
+ * the next sample starts late, a second pending edge would be lost.
+ */
+static inline __attribute__((always_inline)) void benchmark_isr_end(uint16_t start) {
+    uint16_t cycles = TCNT1 - start;
+    benchIsrCyclesSum += cycles;
+    if (cycles < benchIsrCyclesMin) { benchIsrCyclesMin = cycles; }
+    if (cycles > benchIsrCyclesMax) { benchIsrCyclesMax = cycles; }
+    if (cycles > BENCHMARK_ISR_DEADLINE_CYCLES) { benchIsrOverruns++; }
+    if (EIFR & _BV(INTF1)) { benchIsrMissed++; }
+    benchIsrSamples++;
+    benchSampleClock++;
+}
+
+/** @brief Stamps a new pitch value in ISR(INT1_vect). */
+static inline __attribute__((always_inline)) void benchmark_pitch_ready() {
+    benchPitchStamp = benchSampleClock;
+}
+
+/** @brief Stamps a new volume value in ISR(INT1_vect). */
+static inline __attribute__((always_inline)) void benchmark_volume_ready() {
+    benchVolumeStamp = benchSampleClock;
+}
+
+void benchmark_pitch_used();
+void benchmark_volume_used();
+void benchmark_loop();
+void benchmark_print();
+
+#endif // ISR_BENCHMARK
+
+#endif // _BENCHMARK_H_
@@ -2,9 +2,9 @@
 #include "dac.h"
 #include "timer.h"
 #include "ihandlers.h"
-#include "../../eeprom.h"
 #include "../../build_options.h"
 #include "hw.h"
+#include "settings.h"
 
 
 // calibration
@@ -26,10 +26,8 @@ void printCalibrationDetails() {
     float voPitchFreq = PITCH_FIXED_OSCILLATOR_FREQUENCY - pitchBeatHz;
     float voVolFreq = VOLUME_FIXED_OSCILLATOR_FREQUENCY - volBeatHz;
 
-    int16_t pitchDAC = 0;
-    int16_t volumeDAC = 0;
-    EEPROM.get(EEPROM_PITCH_DAC_VOLTAGE_ADDRESS, pitchDAC);
-    EEPROM.get(EEPROM_VOLUME_DAC_VOLTAGE_ADDRESS, volumeDAC);
+    int16_t pitchDAC = settings.data.pitchDAC;
+    int16_t volumeDAC = settings.data.volumeDAC;
 
     Serial.println(F("--- Calibration Summary ---"));
     Serial.print(F("Pitch ticks:        ")); Serial.println(pitchCalibrationBase);
@@ -49,91 +47,351 @@ void printCalibrationDetails() {
 #endif
 
 
+#ifdef CALIBRATION_DRIFT_TRACKING
+
+#define CALIBRATION_DRIFT_WINDOW        256     // hands-away samples are within +-256 ticks of the base (~1 %)
+#define CALIBRATION_DRIFT_SAMPLES_SHIFT 12      // 4096 consecutive samples per trim (~6 s at 700 Hz beat)
+#define CALIBRATION_DRIFT_TRIM_SHIFT    2       // each trim moves the base by 1/4 of the measured offset
+#define CALIBRATION_DRIFT_LIMIT         1024    // maximum trim from the calibrated base
+#define CALIBRATION_DRIFT_COMMIT        32      // minimum change before writing the EEPROM
+#define CALIBRATION_DRIFT_STABLE        64      // largest spread of the samples of a stretch, a moving hand is more
+#define CALIBRATION_DRIFT_SETTLE        1024    // stable samples before the average starts (~1.5 s at 700 Hz beat)
+
+/**
+ * @brief Drift tracking state of one oscillator.
+ */
+typedef struct {
+    int32_t *base;          // pitchCalibrationBase or volCalibrationBase
+    int32_t calibrated;     // base at boot or the last calibration, reference of the limit
+    int32_t stored;         // base last written to EEPROM
+    int32_t *setting;       // settings.data field of the base
+    uint32_t sum;           // sum of the consecutive hands-away samples
+    uint16_t count;
+    uint16_t settled;       // stable samples so far, the average starts at CALIBRATION_DRIFT_SETTLE
+    uint16_t low;           // lowest and highest sample since the stretch started
+    uint16_t high;
+} drift_t;
+
+static drift_t _pitch_drift = { &pitchCalibrationBase, 0, 0, &settings.data.pitchCalibrationBase, 0, 0, 0, 0, 0 };
+static drift_t _volume_drift = { &volCalibrationBase, 0, 0, &settings.data.volCalibrationBase, 0, 0, 0, 0, 0 };
+
+/** Starts a new stretch at one sample, or at none for period 0. */
+static void calibration_drift_restart(drift_t *d, uint16_t period) {
+    d->sum = 0;
+    d->count = 0;
+    d->settled = 0;
+    d->low = d->high = period;
+}
+
+static void calibration_drift_init(drift_t *d) {
+    d->calibrated = d->stored = *d->base;
+    calibration_drift_restart(d, 0);
+}
+
+/**
+ * @brief Averages the hands-away samples and trims the base a little every 4096 of them.
+ *
+ * Muted doesn't mean hands away, the player can mute with a hand in the field.
+ * So the samples must also be settled: a stretch restarts on a sample away
+ * from the base or when its samples spread over more than CALIBRATION_DRIFT_STABLE
+ * ticks (a hand moving, or leaving the field), and its first CALIBRATION_DRIFT_SETTLE
+ * samples are not averaged. Only a long steady stretch close to the base is used.
+ */
+static void calibration_drift_sample(drift_t *d, uint16_t period) {
+    int32_t base = *d->base;
+    if (abs((int32_t)period - base) > CALIBRATION_DRIFT_WINDOW) {
+        calibration_drift_restart(d, 0);
+        return;
+    }
+    if (d->low == 0) {
+        d->low = d->high = period;
+    } else {
+        if (period < d->low) { d->low = period; }
+        if (period > d->high) { d->high = period; }
+        if (d->high - d->low > CALIBRATION_DRIFT_STABLE) {
+            calibration_drift_restart(d, period);
+            return;
+        }
+    }
+    if (d->settled < CALIBRATION_DRIFT_SETTLE) {
+        d->settled++;
+        return;
+    }
+    d->sum += period;
+    if (++d->count < (1U << CALIBRATION_DRIFT_SAMPLES_SHIFT)) { return; }
+
+    int32_t average = d->sum >> CALIBRATION_DRIFT_SAMPLES_SHIFT;
+    d->sum = 0;
+    d->count = 0;
+    d->low = d->high = period;      // the next stretch is still settled, its spread starts here
+    base += (average - base) / (1 << CALIBRATION_DRIFT_TRIM_SHIFT);
+    base = constrain(base, d->calibrated - CALIBRATION_DRIFT_LIMIT, d->calibrated + CALIBRATION_DRIFT_LIMIT);
+    *d->base = base;
+
+    if (abs(base - d->stored) > CALIBRATION_DRIFT_COMMIT) {
+        d->stored = base;
+        *d->setting = base;
+        settings.save();
+        DEBUG_PRINT(F("drift base ")); DEBUG_PRINTLN(base);
+    }
+}
+
+/**
+ * @brief Feeds a pitch period into the drift tracking, call only while muted.
+ */
+void calibration_track_pitch(uint16_t period) {
+    calibration_drift_sample(&_pitch_drift, period);
+}
+
+/**
+ * @brief Feeds a volume period into the drift tracking, call only while muted.
+ */
+void calibration_track_volume(uint16_t period) {
+    calibration_drift_sample(&_volume_drift, period);
+}
+
+/**
+ * @brief Restarts the averages, e.g. when the theremin gets muted.
+ */
+void calibration_track_reset() {
+    calibration_drift_restart(&_pitch_drift, 0);
+    calibration_drift_restart(&_volume_drift, 0);
+}
+
+#endif // CALIBRATION_DRIFT_TRACKING
+
+
 /*******************************************
  *          CALIBRATION ROUTINES
  *******************************************/
 
- 
+#define CALIBRATION_MAX_ITERATIONS      12      // secant iterations per oscillator
+#define CALIBRATION_MAX_POINTS          (2 + CALIBRATION_MAX_ITERATIONS) // measured DAC values per oscillator
+#define CALIBRATION_GATE_MIN_MS         50      // gate time far from the target (20 Hz resolution)
+#define CALIBRATION_GATE_MAX_MS         250     // gate time close to the target (4 Hz resolution)
+#define CALIBRATION_GATE_RESOLUTION     16      // resolve 1/16 of the remaining frequency error
+#define CALIBRATION_SETTLE_MIN_MS       10      // oscillator settling after a small DAC step
+#define CALIBRATION_SETTLE_MAX_MS       100     // oscillator settling after a full scale DAC step
+#define CALIBRATION_RESTART_MS          100     // audio interrupts running before the final capture
+#define CALIBRATION_COUNTDOWN_STEPS     10      // LED countdown before the measurements start
+
+// quick recalibration: warm start around the DAC values stored in EEPROM
+#define CALIBRATION_QUICK_SPAN          64      // initial bracket, DAC steps on each side of the stored value
+#define CALIBRATION_QUICK_MAX_ITERATIONS 4      // secant iterations before falling back to the full search
+#define CALIBRATION_QUICK_GATE_MIN_MS   20      // 50 Hz resolution
+#define CALIBRATION_QUICK_GATE_MAX_MS   125     // 8 Hz resolution, still half of CalibrationTolerance
+#define CALIBRATION_QUICK_COUNTDOWN_STEPS 4
+
+typedef enum {
+    calibration_stage_t_idle,
+    calibration_stage_t_countdown,      // LED countdown, the player moves the hands away
+    calibration_stage_t_settle,         // new DAC value, waiting for the oscillator
+    calibration_stage_t_measure,        // gate open, counting oscillator cycles
+    calibration_stage_t_restart,        // audio interrupts restored, waiting for the final capture
+} calibration_stage_t;
+
 /**
- * @brief Measures the absolute frequency of the pitch oscillator (VO_PITCH).
- *
- * This function uses Timer1 in normal mode to count the number of clock cycles
- * over a 1-second window (via `delay(1000)`) to compute the frequency of the
- * signal arriving on PD5 (ICP1).
- *
- * Timer1 is configured with a prescaler of 1024, so its effective counting frequency is:
- *   16,000,000 / 1024 = 15,625 Hz.
- *
- * The function resets the counter and overflow register before starting measurement,
- * then accumulates the total number of clock ticks over the 1-second duration.
+ * @brief Secant method state of the oscillator being calibrated.
+ */
+typedef struct {
+    int16_t xn0, xn1;       // last two DAC values
+    int32_t fn0, fn1;       // their frequency error to the target (Hz)
+    int32_t target;         // target oscillator frequency (Hz)
+    uint8_t points;         // DAC values measured so far
+} secant_t;
+
+static calibration_stage_t _stage = calibration_stage_t_idle;
+static uint8_t _channel = GATE_COUNTER_NONE;    // oscillator being calibrated: GATE_COUNTER_PITCH or _VOLUME
+static secant_t _secant;
+static uint8_t _countdown = 0;                  // LED countdown step
+static unsigned long _stage_start = 0;          // millis() at the start of the countdown step / restart
+static uint16_t _gate_ms = 0;                   // length of the running measurement gate
+static int16_t _pitch_dac = 0;                  // results, stored only if the whole calibration succeeds
+static int16_t _volume_dac = 0;
+static uint8_t _progress = 0xff;                // last progress step sent to the display
+static bool _quick_requested = false;           // quick recalibration requested by the display
+static bool _quick = false;                     // warm started search for the current oscillator
+
+/**
+ * @brief Reads the oscillator cycles counted during the last calibration gate.
  *
- * @details
- * - This method is typically called during the calibration procedure.
- * - It indirectly measures VO_PITCH, a ~500 kHz RF signal, by leveraging
- *   frequency aliasing from the physical RF circuitry and flip-flop gating (F_PITCH).
- * - Timer1 overflows at 65536 ticks, so the `timer_overflow_counter` accounts for overflows.
+ * - VO_PITCH: Timer1 counts + 65536 * Timer1 overflows
+ * - VO_VOL:   Timer0 counts + 256 * Timer0 compare matches (OCR0A = 0xff)
  *
- * The final frequency count is:
- * @code
- *   frequency = TCNT1 + 65536 * timer_overflow_counter;
- * @endcode
+ * @note Only valid once ihCalibrationGateExpired(), the counter is stopped then.
+ * @return The oscillator frequency in Hz (cycles scaled to a 1 second gate).
+ */
+static int32_t calibration_gate_frequency() {
+    uint32_t cycles;
+    if (_channel == GATE_COUNTER_PITCH) {
+        cycles = TCNT1 + 65536UL * (uint32_t)timer_overflow_counter;
+    } else {
+        cycles = TCNT0 + 256UL * (uint32_t)timer_overflow_counter;
+    }
+    return cycles * 1000UL / _gate_ms;
+}
+
+/**
+ * @brief Sends a DAC value to the oscillator being calibrated and waits for it to settle.
  *
+ * The settling time follows the size of the DAC step: a full scale jump needs
+ * CALIBRATION_SETTLE_MAX_MS, the small corrections near the end of the secant
+ * method settle within a few ms.
+ */
+static void calibration_set_dac(int16_t value, uint16_t step) {
+    if (_channel == GATE_COUNTER_PITCH) {
+        SPImcpDAC2Asend(value);
+    } else {
+        SPImcpDAC2Bsend(value);
+    }
+    uint16_t settle = CALIBRATION_SETTLE_MIN_MS
+        + (uint32_t)step * (CALIBRATION_SETTLE_MAX_MS - CALIBRATION_SETTLE_MIN_MS) / DAC_12BIT_MAX;
+    ihStartCalibrationGate(settle, GATE_COUNTER_NONE);
+    _stage = calibration_stage_t_settle;
+}
+
+/**
+ * @brief Gate time for the next measurement.
  *
- * @return The measured pitch frequency in Timer1 ticks over 1 second, to be converted externally.
+ * A gate of T ms resolves 1000 / T Hz. Far from the target the secant step doesn't
+ * need that resolution and a short gate is used, the gate gets longer as the error
+ * shrinks so that the last steps still resolve a quarter of CalibrationTolerance.
  */
-uint32_t GetPitchMeasurement() {
-    DEBUG_PRINT(F("GetPitchMeasurement "));
-    TCNT1 = 0;                      // Reset Timer1 counter
-    timer_overflow_counter = 0;     // Reset overflow counter
-    // Set Timer1 with prescaler 1024 (CS12 | CS11 | CS10)
-    // Resulting timer tick: 16 MHz / 1024 = 15.625 kHz
-    TCCR1B = (1 << CS12) | (1 << CS11) | (1 << CS10);
-    delay(1000);                    // Measure duration: 1000 ms (blocking)
-    TCCR1B = 0;                     // Stop Timer1 after measurement
-    // Combine Timer1 count with overflow count to get full frequency count
-    uint32_t frequency = TCNT1;
-    uint32_t temp = 65536UL * (uint32_t)timer_overflow_counter;
-    frequency += temp;
-    // measured_Hz = measuredTicks * (16e6 / 1024) / 1.0 for 1s integration time
-    DEBUG_PRINT(F("tcnt1="));DEBUG_PRINT(TCNT1);DEBUG_PRINT(F(" ovfl="));DEBUG_PRINT(timer_overflow_counter);DEBUG_PRINT(F(" f="));DEBUG_PRINTLN(frequency);
-    return frequency;
+static uint16_t calibration_gate_time() {
+    const uint16_t gate_min = _quick ? CALIBRATION_QUICK_GATE_MIN_MS : CALIBRATION_GATE_MIN_MS;
+    const uint16_t gate_max = _quick ? CALIBRATION_QUICK_GATE_MAX_MS : CALIBRATION_GATE_MAX_MS;
+    if (_secant.points < 2) { return gate_min; }    // bracket ends
+    uint32_t error = abs(_secant.fn1);
+    if (error == 0) { return gate_max; }
+    uint32_t gate = 1000UL * CALIBRATION_GATE_RESOLUTION / error;
+    return constrain(gate, gate_min, gate_max);
 }
 
 /**
- * @brief Measures the frequency of the volume antenna oscillator (VO_VOL).
+ * @brief Sends the calibration progress to the display, in steps of 5 %.
  *
- * This function uses Timer/Counter0 in external clock mode to count rising edges
- * from the VO_VOL signal (connected to T0 / PD4 / Digital Pin 4) over a 1-second
- * gate window determined by Timer1 overflow.
+ * Pitch takes the first half, volume the second. Each oscillator counts
+ * CALIBRATION_MAX_POINTS measurements, an oscillator converging early jumps ahead.
+ */
+static void calibration_report_progress() {
+    uint8_t points = _secant.points + (_channel == GATE_COUNTER_VOLUME ? CALIBRATION_MAX_POINTS : 0);
+    uint8_t progress = (uint16_t)points * 20 / (2 * CALIBRATION_MAX_POINTS);   // 0..20
+    if (progress > 19) { progress = 19; }   // 100 % is the result opcode
+    if (progress != _progress) {
+        _progress = progress;
+        Serial.write(STATE_CMD_CALIBRATION_PROGRESS_BASE + progress);
+    }
+}
+
+/**
+ * @brief Starts the secant method for one oscillator at the lower end of the bracket.
  *
- * Timer1 is preloaded with 49911 to overflow after ~1 second (65536 - 49911 = 15625 ticks @ 16 MHz).
- * Timer0 counts external rising edges from VO_VOL during this gate time.
- * The result is the total number of VO_VOL cycles within one second.
+ * The bracket is the full DAC range, or for a quick recalibration
+ * +-CALIBRATION_QUICK_SPAN around the DAC value stored in EEPROM
+ * (if there is a valid one).
  *
- * @return Frequency in Hz as an uint32_t value.
+ * - VO_PITCH: target 500 kHz (U2 Q5 = 16 MHz / 32) minus PitchFreqOffset,
+ *   the volume oscillator is biased to keep it away from the pitch oscillator.
+ * - VO_VOL: target 460.8 kHz (U3 Q4 = 7.3728 MHz / 16) minus VolumeFreqOffset,
+ *   the pitch oscillator runs at its new calibration value.
+ */
+static void calibration_begin_channel(uint8_t channel, bool quick) {
+    _channel = channel;
+    _secant.xn0 = 0;                    // Lower DAC bound
+    _secant.xn1 = DAC_12BIT_MAX;        // Upper DAC bound (max for 12-bit DAC)
+    _secant.points = 0;
+
+    int16_t stored = -1;
+    if (quick) {
+        stored = (channel == GATE_COUNTER_PITCH) ? settings.data.pitchDAC : settings.data.volumeDAC;
+    }
+    _quick = stored >= 0 && stored <= DAC_12BIT_MAX;   // blank EEPROM reads -1
+    if (_quick) {
+        _secant.xn0 = constrain(stored - CALIBRATION_QUICK_SPAN, 0, DAC_12BIT_MAX);
+        _secant.xn1 = constrain(stored + CALIBRATION_QUICK_SPAN, 0, DAC_12BIT_MAX);
+    }
+
+    if (channel == GATE_COUNTER_PITCH) {
+        _secant.target = PITCH_FIXED_OSCILLATOR_FREQUENCY - PitchFreqOffset;   // Correct for calibration drift
+        DEBUG_PRINTLN(F("\nPITCH CALIBRATION"));
+        ihInitialisePitchMeasurement();     // Setup Timer1 and associated ISR flags
+        SPImcpDACinit();                    // Initialize DACs
+        SPImcpDAC2Bsend(1600);              // bias the volume oscillator for pitch calibration
+    } else {
+        _secant.target = VOLUME_FIXED_OSCILLATOR_FREQUENCY - VolumeFreqOffset;
+        DEBUG_PRINTLN(F("\nVOLUME CALIBRATION"));
+        ihInitialiseVolumeMeasurement();    // Configure Timer0 and related registers
+        SPImcpDACinit();                    // Re-initialize DAC interface
+        SPImcpDAC2Asend(_pitch_dac);
+    }
+    DEBUG_PRINT(F("Set f= ")); DEBUG_PRINTLN(_secant.target);
+    calibration_set_dac(_secant.xn0, _quick ? CALIBRATION_QUICK_SPAN : DAC_12BIT_MAX);
+}
+
+/**
+ * @brief Restores the playing configuration: DAC values, timers and the audio interrupts.
+ */
+static void calibration_restore_interrupts() {
+    ihStopCalibrationGate();
+    ihInitialiseTimer();
+    ihInitialiseInterrupts();
+}
+
+/**
+ * @brief Evaluates a finished measurement and moves the secant method one step on.
  *
- * @note Timer0 is 8-bit, so an overflow counter is used to extend its range.
- *       This approach trades resolution for simplicity, which is acceptable for volume
- *       since it does not require the same precision or update rate as pitch.
+ * The first two measurements span the full DAC range. After that every step
+ * measures only the new DAC value, the previous one is reused from the step before.
+ * The oscillator is calibrated when the last two DAC values are within
+ * CalibrationTolerance of each other.
  *
- * @warning This method assumes Timer0 and Timer1 are not used elsewhere during execution.
+ * @return false if the oscillator didn't converge within CALIBRATION_MAX_ITERATIONS.
  */
-uint32_t GetVolumeMeasurement() {
-    DEBUG_PRINT(F("GetVolumeMeasurement "));
-    timer_overflow_counter = 0;                                 // Clear overflow tracker for Timer0
-    TCNT0 = 0;                                                  // Reset Timer0 (pulse counter)
-    TCNT1 = 49911;                                              // Preload Timer1 so it overflows in 1s (65536 - 49911 = 15625 ticks @ 16 MHz)
-    // Set Timer0 to external clock on T0 (PD4), count on rising edge
-    TCCR0B = (1 << CS02) | (1 << CS01) | (1 << CS00);
-    // Clear Timer1 overflow flag (to detect overflow event)
-    TIFR1 = (1 << TOV1);                                        //Timer1 INT Flag Reg: Clear Timer Overflow Flag
-    while (!(TIFR1 & ((1 << TOV1)))) {}                         // Wait until Timer1 overflows (1s interval)
-    TCCR0B = 0;                                                 // Stop TimerCounter 0
-    uint32_t frequency = TCNT0;                                 // Retrieve measured pulse count from Timer0 and overflow counter
-    uint32_t temp = (uint32_t)timer_overflow_counter;           // Each Timer0 overflow = 256 pulses
-    frequency += temp * 256;
-    DEBUG_PRINT(F("tcnt0="));DEBUG_PRINT(TCNT0);DEBUG_PRINT(F(" ovfl="));DEBUG_PRINT(temp);DEBUG_PRINT(F(" f="));DEBUG_PRINTLN(frequency);
-    return frequency;
+static bool calibration_evaluate(int32_t frequency) {
+    int32_t error = frequency - _secant.target;
+    _secant.points++;
+    HW_LED_BLUE_TOGGLE;     // visual feedback
+
+    if (_secant.points == 1) {
+        _secant.fn0 = error;
+        calibration_set_dac(_secant.xn1, _secant.xn1 - _secant.xn0);
+        return true;
+    }
+
+    _secant.fn1 = error;
+    DEBUG_PRINT(F("\nDAC L: ")); DEBUG_PRINT(_secant.xn0); DEBUG_PRINT(F(" fL: ")); DEBUG_PRINTLN(_secant.fn0);
+    DEBUG_PRINT(F("DAC H: ")); DEBUG_PRINT(_secant.xn1); DEBUG_PRINT(F(" fH: ")); DEBUG_PRINTLN(_secant.fn1);
+
+    if (abs(_secant.fn0 - _secant.fn1) <= CalibrationTolerance) {
+        if (_channel == GATE_COUNTER_PITCH) {
+            _pitch_dac = _secant.xn1;
+            calibration_begin_channel(GATE_COUNTER_VOLUME, _quick_requested);
+        } else {
+            _volume_dac = _secant.xn1;
+            calibration_restore_interrupts();
+            _stage_start = millis();
+            _stage = calibration_stage_t_restart;
+        }
+        return true;
+    }
+    if (_quick && _secant.points >= 2 + CALIBRATION_QUICK_MAX_ITERATIONS) {
+        DEBUG_PRINTLN(F("quick recal failed, full search"));
+        calibration_begin_channel(_channel, false);
+        return true;
+    }
+    if (_secant.points >= CALIBRATION_MAX_POINTS) {
+        return false;
+    }
+
+    // Secant approximation to refine DAC value
+    int32_t xn2 = _secant.xn1 - ((int32_t)(_secant.xn1 - _secant.xn0) * _secant.fn1) / (_secant.fn1 - _secant.fn0);
+    xn2 = constrain(xn2, 0, DAC_12BIT_MAX);
+    uint16_t step = abs(xn2 - _secant.xn1);
+    _secant.xn0 = _secant.xn1;
+    _secant.fn0 = _secant.fn1;
+    _secant.xn1 = xn2;
+    calibration_set_dac(_secant.xn1, step);
+    return true;
 }
 
 /**
@@ -155,20 +413,18 @@ uint32_t GetVolumeMeasurement() {
  *    - Captures `volCalibrationBase` from the Timer1 delta.
  *
  * 3. **EEPROM Storage:**
+ *    - Stores the DAC values found by the secant method (addresses 0 and 2)
  *    - Stores calibration values:
  *      - At address 4: `pitchCalibrationBase` (4 bytes)
  *      - At address 8: `volCalibrationBase` (4 bytes)
  *
  * @returns true if success, to avoid writing invalid calibration data in EEPROM
  *
- * @note Calibration uses blocking wait with optional timeout of 10 ms for each channel.
+ * @note Calibration uses blocking wait with optional timeout of 10 ms for each channel.
  *       It assumes the player is holding still, and RF conditions are stable.
  *
  * @warning Requires successful pitch/volume ISR processing to populate
  *          `pitchValueAvailable` and `volumeValueAvailable` before timeout.
- *
- * @see GetPitchMeasurement()
- * @see GetVolumeMeasurement()
  */
 bool calibration_finalize() {
     // use temporary storage in case calibration fails
@@ -187,7 +443,7 @@ bool calibration_finalize() {
     while (!success && !timerExpiredMillis(10)) { success = pitchValueAvailable; }
     if (success) {
         success = false; // retry for volume
-        pitch_calibration_val = pitch;           // Store raw pitch counter
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { pitch_calibration_val = pitch; }           // Store raw pitch counter
         // --- Final Volume calibration persistance---
         volumeValueAvailable = false;     // Clear volumeValueAvailable
         resetTimer();       // Reset system timer
@@ -195,23 +451,30 @@ bool calibration_finalize() {
         // Wait for new volume value or timeout after 10ms
         while (!success && !timerExpiredMillis(10)) { success = volumeValueAvailable; }
         if (success) {
-            volume_calibration_val = vol;               // Store raw volume counter
-            #ifdef SERIAL_DEBUG_MESSAGES
-            printCalibrationDetails();
-            #endif
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { volume_calibration_val = vol; }               // Store raw volume counter
 
             // check if calibration was within valid limits
-            float pitchBeatHz = master_clock_frequency / pitchCalibrationBase;
-            float volBeatHz = master_clock_frequency / volCalibrationBase;
+            float pitchBeatHz = (float)master_clock_frequency / pitch_calibration_val;
+            float volBeatHz = (float)master_clock_frequency / volume_calibration_val;
             success = abs(pitchBeatHz - PitchFreqOffset) < CALIBRATION_BASE_MAX_DRIFT;
             if (success) {
                 success = abs(volBeatHz - VolumeFreqOffset) < CALIBRATION_BASE_MAX_DRIFT;
                 if (success) {
                     pitchCalibrationBase = pitch_calibration_val;
                     volCalibrationBase = volume_calibration_val;
-                    // --- Store calibration baseline results in EEPROM ---
-                    EEPROM.put(EEPROM_PITCH_DAC_CALIBRATION_BASE_ADDRESS, pitchCalibrationBase);    // Save pitch baseline (4 bytes)
-                    EEPROM.put(EEPROM_VOLUME_DAC_CALIBRATION_BASE_ADDRESS, volCalibrationBase);     // Save volume baseline (4 bytes)
+                    // --- Store calibration results in EEPROM ---
+                    settings.data.pitchDAC = _pitch_dac;                            // Final calibrated DAC value for VO_PITCH
+                    settings.data.volumeDAC = _volume_dac;                          // DAC value for volume oscillator compensation
+                    settings.data.pitchCalibrationBase = pitchCalibrationBase;      // Pitch baseline
+                    settings.data.volCalibrationBase = volCalibrationBase;          // Volume baseline
+                    settings.save();                                                // One record, next slot of the ring
+                    #ifdef SERIAL_DEBUG_MESSAGES
+                    printCalibrationDetails();
+                    #endif
+                    #ifdef CALIBRATION_DRIFT_TRACKING
+                    calibration_drift_init(&_pitch_drift);
+                    calibration_drift_init(&_volume_drift);
+                    #endif
                 }
             }
         }
@@ -220,218 +483,116 @@ bool calibration_finalize() {
 }
 
 /**
- * @brief Performs pitch oscillator calibration using a numerical approximation.
- *
- * This function tunes the DAC output controlling the VO_PITCH oscillator to align
- * the oscillator frequency with the reference frequency derived from the 16 MHz crystal.
- *
- * ### Calibration Goal:
- * - Find the correct DAC setting (`pitchXn`) so that the pitch oscillator outputs exactly 500 kHz,
- *   matching the divided reference frequency (U2 Q5 = 16 MHz / 32).
- *
- * ### Algorithm Summary:
- * - The search interval is initialized with `pitchXn0 = 0` and `pitchXn1 = 4095`.
- * - It uses a form of secant method (similar to dichotomy/bisection) to iteratively find
- *   the optimal DAC value that minimizes the frequency delta (`pitchfn0 - pitchfn1`).
- * - Loop is limited to 12 iterations, sufficient for 12-bit resolution convergence.
- *
- * ### EEPROM Storage:
- * - The final calibrated DAC value is written to EEPROM address 0.
- * 
- * @returns true if successfully calibrated.
- *
- * @warning Requires VO_PITCH oscillator to be stable during calibration.
- * @note Uses blocking `delay()` and relies on GetPitchMeasurement(), which uses Timer1 counting.
- * @see GetQMeasurement()
- * @see GetPitchMeasurement()
+ * @brief Gives up the running calibration and restores the stored one.
  */
-bool calibrate_pitch() {
-    int16_t pitchXn0 = 0;    // Lower DAC bound
-    int16_t pitchXn1 = DAC_12BIT_MAX;    // Upper DAC bound (max for 12-bit DAC)
-    int16_t pitchXn2 = 0;    // Midpoint in iteration
-    static const float q0 = (master_clock_frequency / master_clock_frequency * PITCH_FIXED_OSCILLATOR_FREQUENCY); // Count Timer1 ticks over 31.25k cycles
-    long pitchfn0 = 0;       // Measured pitch frequencies
-    long pitchfn1 = 0;
-    long pitchfn = q0 - PitchFreqOffset;     // Correct for calibration drift
-
-    DEBUG_PRINTLN(F("\nPITCH CALIBRATION"));
-    DEBUG_PRINT(F("Set f= ")); DEBUG_PRINTLN(pitchfn);
-
-    ihInitialisePitchMeasurement();     // Setup Timer1 and associated ISR flags
-    //sei();
-    SPImcpDACinit();                    // Initialize DACs
-
-    SPImcpDAC2Bsend(1600);          // bias the volume oscillator for pitch calibration
-    SPImcpDAC2Asend(pitchXn0);      // Frequency at low DAC value
-    delay(100);
-    pitchfn0 = GetPitchMeasurement();
-    SPImcpDAC2Asend(pitchXn1);      // Frequency at high DAC value
-    delay(100);
-    pitchfn1 = GetPitchMeasurement();
-
-    DEBUG_PRINT(F("Tune range ")); DEBUG_PRINT(pitchfn0); DEBUG_PRINT(F(" to ")); DEBUG_PRINTLN(pitchfn1);
-
-    uint8_t cal_iteration = 0; // Max 12 iterations
-    while (abs(pitchfn0 - pitchfn1) > CalibrationTolerance && (cal_iteration < 12)) {
-        SPImcpDAC2Asend(pitchXn0);
-        delay(100);
-        pitchfn0 = GetPitchMeasurement() - pitchfn;
-
-        SPImcpDAC2Asend(pitchXn1);
-        delay(100);
-        pitchfn1 = GetPitchMeasurement() - pitchfn;
-
-        // Secant approximation to refine DAC value
-        pitchXn2 = pitchXn1 - ((pitchXn1 - pitchXn0) * pitchfn1) / (pitchfn1 - pitchfn0); // new DAC value
-
-        DEBUG_PRINT("\nDAC L: "); DEBUG_PRINT(pitchXn0); DEBUG_PRINT(" fL: "); DEBUG_PRINTLN(pitchfn0);
-        DEBUG_PRINT("DAC H: "); DEBUG_PRINT(pitchXn1); DEBUG_PRINT(" fH: "); DEBUG_PRINTLN(pitchfn1);
-
-        pitchXn0 = pitchXn1;
-        pitchXn1 = pitchXn2;
-
-        HW_LED_BLUE_TOGGLE;     // visual feedback
-        cal_iteration++;
-    }
-    delay(100);
-
-    bool success = cal_iteration < 12;
-    if (success) {
-        EEPROM.put(EEPROM_PITCH_DAC_VOLTAGE_ADDRESS, pitchXn0); // Store final calibrated DAC value for VO_PITCH
-    }
-    return success;
+static void calibration_abort() {
+    calibration_restore_interrupts();
+    calibration_read();     // restore previous calibration DAC values
+    _stage = calibration_stage_t_idle;
 }
 
 /**
- * @brief Replacement function for delay() used only during VO_VOL measurement in calibration.
+ * @brief Starts a calibration, to be advanced by calibration_step() from the main loop.
  *
- * calling delay() will block the MCU completely because the same timer
- * used by delay() is already being used for the actual frequency measurement.
- * The fixed constant 44316 represents the equivalent of 100ms of delay.
+ * The calibration runs in stages so the main loop and the UART keep running:
+ * 1. LED countdown, signals the player to move the hands away from the antennas
+ * 2. secant method for VO_PITCH, then VO_VOL: set DAC, settle, measure (Timer2 gate)
+ * 3. audio interrupts restored, final capture of the beat periods (calibration_finalize())
  *
- * @warning Requires stable oscillator and clean signal edges on VO_VOL for accurate timing.
- * 
+ * Nothing is written to EEPROM unless all of them succeed.
+ *
+ * @param quick warm start the secant method around the stored DAC values with
+ *        shorter gates and countdown, each oscillator falls back to the full
+ *        search if it doesn't converge within CALIBRATION_QUICK_MAX_ITERATIONS.
  */
-void delay_NOP() {
-    volatile unsigned long i = 0;
-    for (i = 0; i < 44316; i++) {
-        __asm__ __volatile__("nop");
-    }
+void calibration_begin(bool quick) {
+    _quick_requested = quick;
+    _countdown = 0;
+    _progress = 0xff;
+    _stage_start = millis();
+    _stage = calibration_stage_t_countdown;
 }
 
-
 /**
- * @brief Performs volume oscillator calibration using iterative frequency measurement.
- *
- * This function finds the optimal DAC value that aligns the VO_VOL oscillator frequency
- * with the reference frequency derived from the second crystal (X2 at 7.3728 MHz).
+ * @brief Advances the running calibration, returns immediately.
  *
- * ### Calibration Goal:
- * - Align the VO_VOL oscillator frequency with a nominal target:  
- *   7.3728 MHz / 16 (Q4 from U2) = 460,800 Hz.
+ * Sends STATE_CMD_CALIBRATION_PROGRESS_BASE + 0..19 (5 % steps) while running and
+ * STATE_CMD_CALIBRATION_SUCCESS or STATE_CMD_CALIBRATION_ERROR when finished.
  *
- * ### Calibration Strategy:
- * - Like the pitch routine, this uses a secant-like numerical approach over 12-bit DAC range.
- * - Uses a 100 ms delay (`waitNOP(44316)`) between DAC value changes and frequency measurement
- *   to ensure the RF circuit stabilizes.
- *
- * ### EEPROM Storage:
- * - The resulting DAC value is stored at EEPROM address 2.
- *
- * @returns true if successfully calibrated.
- * 
- * @note The DAC2B channel is used for volume oscillator control.
- * @warning Requires stable oscillator and clean signal edges on VO_VOL for accurate timing.
- * @see GetVolumeMeasurement()
+ * @return calibration_result_t_running until the calibration is finished.
  */
-bool calibrate_volume() {
-    int16_t volumeXn0 = 0;   // Lower DAC bound
-    int16_t volumeXn1 = DAC_12BIT_MAX;   // Upper DAC bound
-    int16_t volumeXn2 = 0;   // Next DAC trial value
-    // Calculate actual frequency from X2 crystal via prior master_clock_frequency (from X1 at 16 MHz)
-    // Target frequency: 7372800 / 16 = 460800
-    static const float q0 = (master_clock_frequency / master_clock_frequency * VOLUME_FIXED_OSCILLATOR_FREQUENCY);            // Calculated oscillator frequency based on crystal measurement
-    int32_t volumefn0 = 0;      // Frequency measurements
-    int32_t volumefn1 = 0;
-    int32_t volumefn = q0 - VolumeFreqOffset;
-
-    DEBUG_PRINTLN(F("\nVOLUME CALIBRATION"));
-    DEBUG_PRINT("Vf="); DEBUG_PRINTLN(volumefn);
-
-    ihInitialiseVolumeMeasurement();    // Configure Timer0 and related registers
-    //sei();
-    SPImcpDACinit();                    // Re-initialize DAC interface
-
-    // Measure low and high frequency extremes for DAC sweep range
-    SPImcpDAC2Bsend(volumeXn0);
-    delay_NOP(); 
-    volumefn0 = GetVolumeMeasurement();
-    SPImcpDAC2Bsend(volumeXn1);
-    delay_NOP();
-    volumefn1 = GetVolumeMeasurement();
-
-    DEBUG_PRINT(F("Tune range ")); DEBUG_PRINT(volumefn0); DEBUG_PRINT(" to "); DEBUG_PRINTLN(volumefn1);
-
-    uint8_t cal_iteration = 0; // Max 12 iterations
-    while (abs(volumefn0 - volumefn1) > CalibrationTolerance && (cal_iteration < 12)) {
-        SPImcpDAC2Bsend(volumeXn0);
-        delay_NOP();
-        volumefn0 = GetVolumeMeasurement() - volumefn;
-        SPImcpDAC2Bsend(volumeXn1);
-        delay_NOP();
-        volumefn1 = GetVolumeMeasurement() - volumefn;
-        // Secant method refinement
-        volumeXn2 = volumeXn1 - ((volumeXn1 - volumeXn0) * volumefn1) / (volumefn1 - volumefn0); // calculate new DAC value
-
-        DEBUG_PRINT("\nDAC L: "); DEBUG_PRINT(volumeXn0); DEBUG_PRINT(" fL: "); DEBUG_PRINTLN(volumefn0);
-        DEBUG_PRINT("DAC H: "); DEBUG_PRINT(volumeXn1); DEBUG_PRINT(" fH: "); DEBUG_PRINTLN(volumefn1);
-
-        volumeXn0 = volumeXn1;
-        volumeXn1 = volumeXn2;
-
-        HW_LED_BLUE_TOGGLE;     // visual feedback
-        cal_iteration++;
-    }
-    bool success = cal_iteration < 12;
-    if (success) {
-        EEPROM.put(EEPROM_VOLUME_DAC_VOLTAGE_ADDRESS, volumeXn0); // Store DAC value for volume oscillator compensation
-    }
-    return success;
-}
+calibration_result_t calibration_step() {
+    switch (_stage) {
+        case calibration_stage_t_countdown:
+            if (millis() - _stage_start >= (unsigned long)(200 - (_countdown * 10))) {
+                _stage_start = millis();
+                HW_LED_BLUE_TOGGLE; HW_LED_RED_TOGGLE;
+                if (++_countdown == (_quick_requested ? CALIBRATION_QUICK_COUNTDOWN_STEPS : CALIBRATION_COUNTDOWN_STEPS)) {
+                    // pink color for calibration
+                    HW_LED_BLUE_ON; HW_LED_RED_ON;
+                    calibration_report_progress();
+                    calibration_begin_channel(GATE_COUNTER_PITCH, _quick_requested);
+                }
+            }
+            break;
 
-bool calibration_start() {    
-    bool success = calibrate_pitch();
-    if (success) {
-        success = calibrate_volume();
-    } else {
-        // restore previous calibration DAC values if failed
-        calibration_read();
-    }
+        case calibration_stage_t_settle:
+            if (ihCalibrationGateExpired()) {
+                _gate_ms = calibration_gate_time();
+                ihStartCalibrationGate(_gate_ms, _channel);
+                _stage = calibration_stage_t_measure;
+            }
+            break;
+
+        case calibration_stage_t_measure:
+            if (ihCalibrationGateExpired()) {
+                if (!calibration_evaluate(calibration_gate_frequency())) {
+                    calibration_abort();
+                    Serial.write(STATE_CMD_CALIBRATION_ERROR);
+                    return calibration_result_t_error;
+                }
+                calibration_report_progress();
+            }
+            break;
 
-    ihInitialiseTimer();
-    ihInitialiseInterrupts();
-    millitimer(100);
-    if (success) {
-        success = calibration_finalize();
+        case calibration_stage_t_restart:
+            if (millis() - _stage_start >= CALIBRATION_RESTART_MS) {
+                bool success = calibration_finalize();
+                if (!success) {
+                    calibration_read();     // restore previous calibration DAC values
+                }
+                _stage = calibration_stage_t_idle;
+                Serial.write(success?STATE_CMD_CALIBRATION_SUCCESS:STATE_CMD_CALIBRATION_ERROR);
+                return success ? calibration_result_t_success : calibration_result_t_error;
+            }
+            break;
+
+        case calibration_stage_t_idle:
+        default:
+            return calibration_result_t_error;
     }
-    Serial.write(success?STATE_CMD_CALIBRATION_SUCCESS:STATE_CMD_CALIBRATION_ERROR);
-    return success;
+    return calibration_result_t_running;
 }
 
+/**
+ * @brief Cancels the running calibration, the stored calibration stays in use.
+ */
+void calibration_cancel() {
+    if (_stage != calibration_stage_t_idle) {
+        calibration_abort();
+    }
+}
 
 void calibration_read() {
     SPImcpDACinit();
-    int16_t pitchDAC = 0;
-    int16_t volumeDAC = 0;
-    EEPROM.get(EEPROM_PITCH_DAC_VOLTAGE_ADDRESS, pitchDAC);
-    EEPROM.get(EEPROM_VOLUME_DAC_VOLTAGE_ADDRESS, volumeDAC);
-    EEPROM.get(EEPROM_PITCH_DAC_CALIBRATION_BASE_ADDRESS, pitchCalibrationBase);
-    EEPROM.get(EEPROM_VOLUME_DAC_CALIBRATION_BASE_ADDRESS, volCalibrationBase);
-    SPImcpDAC2Asend(pitchDAC);
-    SPImcpDAC2Bsend(volumeDAC);
-    
-    #ifdef SERIAL_DEBUG_MESSAGES
-    printCalibrationDetails();
+    pitchCalibrationBase = settings.data.pitchCalibrationBase;
+    volCalibrationBase = settings.data.volCalibrationBase;
+    SPImcpDAC2Asend(settings.data.pitchDAC);
+    SPImcpDAC2Bsend(settings.data.volumeDAC);
+
+    #ifdef CALIBRATION_DRIFT_TRACKING
+    calibration_drift_init(&_pitch_drift);
+    calibration_drift_init(&_volume_drift);
     #endif
 
     // TODO: check if valid calibration
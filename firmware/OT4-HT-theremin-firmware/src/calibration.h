@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include "../../build_options.h"
 
 #ifndef _CALIBRATION_H_
 #define _CALIBRATION_H_
@@ -6,7 +7,25 @@
 extern int32_t pitchCalibrationBase;
 extern int32_t volCalibrationBase;
 
+typedef enum {
+    calibration_result_t_running,
+    calibration_result_t_success,
+    calibration_result_t_error,
+} calibration_result_t;
+
 void calibration_read();
-bool calibration_start();
+void calibration_begin(bool quick = false);
+calibration_result_t calibration_step();
+void calibration_cancel();
+
+#ifdef SERIAL_DEBUG_MESSAGES
+void printCalibrationDetails();
+#endif
+
+#ifdef CALIBRATION_DRIFT_TRACKING
+void calibration_track_pitch(uint16_t period);
+void calibration_track_volume(uint16_t period);
+void calibration_track_reset();
+#endif
 
 #endif // _CALIBRATION_H_
\ No newline at end of file
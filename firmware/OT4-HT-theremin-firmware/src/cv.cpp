@@ -1,65 +1,106 @@
 #include "cv.h"
+#include "ihandlers.h"
 
 
-#if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG
 // calculate log2 of an unsigned from 1 to 65535 into a 4.12 fixed point unsigned
 // To avoid use of log (double) function
-// Fixed-point log2 approximation: input is uint16_t linear value
-// Output is 4.12 unsigned fixed-point result (suitable for amplitude scaling, etc.)
+// Table lookup with linear interpolation, 32-bit math only:
+// the exponent is the position of the leading one, the mantissa in [1.0, 2.0)
+// is looked up in 64 segments (error within 0.7 LSB of the 4.12 result, 0.2 cent).
 
+#define LOG2_TABLE_BITS     6       // 64 segments
+#define LOG2_FRAC_BITS      (15 - LOG2_TABLE_BITS)
 
-#define LOG_SCALE    12
-#define POLY_SHIFT   15
-#define OUTPUT_SHIFT 3
-#define BASE_1_0     32768          // 1.0 in s15 fixed-point
-
-// Polynomial coefficients for log2(x) where x ∈ [1.0, 2.0]
-#define POLY_A0  37
-#define POLY_A1  46390
-#define POLY_A2 -18778
-#define POLY_A3   5155
+// log2(1 + i / 64) in 1.15 fixed point, i = 0..64
+static const uint16_t log2_table[(1 << LOG2_TABLE_BITS) + 1] PROGMEM = {
+        0,   733,  1455,  2166,  2866,  3556,  4236,  4907,
+     5568,  6220,  6863,  7498,  8124,  8742,  9352,  9954,
+    10549, 11136, 11716, 12289, 12855, 13415, 13968, 14514,
+    15055, 15589, 16117, 16639, 17156, 17667, 18173, 18673,
+    19168, 19658, 20143, 20623, 21098, 21568, 22034, 22495,
+    22952, 23404, 23852, 24296, 24736, 25172, 25604, 26031,
+    26455, 26876, 27292, 27705, 28114, 28520, 28922, 29321,
+    29717, 30109, 30498, 30884, 31267, 31647, 32024, 32397,
+    32768,
+};
 
 uint16_t log2U16(uint16_t lin_input) {
     if (lin_input == 0)
         return 0;
 
-    // Convert input to 16.16 fixed-point
-    uint32_t long_lin = ((uint32_t)lin_input) << 16;
-    uint32_t log_output = 0;
+    // Fast bit-shifting to isolate integer part of log2, leading one to bit 15
+    uint8_t exponent = 15;
+    if (!(lin_input & 0xff00)) { lin_input <<= 8; exponent -= 8; }
+    if (!(lin_input & 0xf000)) { lin_input <<= 4; exponent -= 4; }
+    if (!(lin_input & 0xc000)) { lin_input <<= 2; exponent -= 2; }
+    if (!(lin_input & 0x8000)) { lin_input <<= 1; exponent -= 1; }
 
-    // Fast bit-shifting to isolate integer part of log2
-    if (long_lin >= (256UL << 16)) {  // 2^8
-        log_output += (8 << LOG_SCALE);
-        long_lin >>= 8;
-    }
-    if (long_lin >= (16UL << 16)) {   // 2^4
-        log_output += (4 << LOG_SCALE);
-        long_lin >>= 4;
-    }
-    if (long_lin >= (4UL << 16)) {    // 2^2
-        log_output += (2 << LOG_SCALE);
-        long_lin >>= 2;
-    }
-    if (long_lin >= (2UL << 16)) {    // 2^1
-        log_output += (1 << LOG_SCALE);
-        long_lin >>= 1;
-    }
+    // Now lin_input is the mantissa in 1.15: segment index and 9-bit fraction below the leading one
+    uint8_t index = (lin_input >> LOG2_FRAC_BITS) & ((1 << LOG2_TABLE_BITS) - 1);
+    uint16_t frac = lin_input & ((1 << LOG2_FRAC_BITS) - 1);
+    uint16_t y0 = pgm_read_word(&log2_table[index]);
+    uint16_t y1 = pgm_read_word(&log2_table[index + 1]);
+    uint16_t mantissa = y0 + (uint16_t)(((uint32_t)(y1 - y0) * frac) >> LOG2_FRAC_BITS);
 
-    // Now long_lin ∈ [1.0, 2.0) in 16.16 -> reduce to 17.15 for signed math
-    long_lin >>= 1;
+    return ((uint16_t)exponent << 12) + ((mantissa + 4) >> 3);  // Adjust to 4.12 fixed-point
+}
 
-    int32_t x = (int32_t)long_lin - BASE_1_0; // x = (x - 1) in s15
-    int32_t x2 = ((int64_t)x * x) >> POLY_SHIFT;
-    int32_t x3 = ((int64_t)x2 * x) >> POLY_SHIFT;
+#if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG || CV_OUTPUT_MODE == CV_OUTPUT_MODE_LINEAR
+static uint16_t cv_pitch = 0;           // last pitch of cv_set_pitch()
+static uint8_t cv_register = 2;         // last register of cv_set_pitch()
+static bool cv_pitch_changed = false;   // cv_task() has to compute a new target
+static int16_t cv_target = 0;           // pitch CV of the last pitch, DAC steps
+static int16_t cv_output = -1;          // pitch CV last sent, DAC steps, -1 = none yet
 
-    // Polynomial approximation: log2(x) ≈ A0 + A1·x + A2·x^2 + A3·x^3
-    int32_t poly = POLY_A0
-                 + (((int64_t)POLY_A1 * x) >> POLY_SHIFT)
-                 + (((int64_t)POLY_A2 * x2) >> POLY_SHIFT)
-                 + (((int64_t)POLY_A3 * x3) >> POLY_SHIFT);
+/**
+ * @brief Takes the clamped pitch of the main loop, the CV itself is computed by cv_task().
+ */
+void cv_set_pitch(uint16_t clampedPitch, uint8_t reg) {
+    if (clampedPitch == cv_pitch && reg == cv_register) { return; }
+    cv_pitch = clampedPitch;
+    cv_register = reg;
+    cv_pitch_changed = true;
+}
 
-    log_output += (poly >> OUTPUT_SHIFT);  // Adjust to 4.12 fixed-point
+/**
+ * @brief Pitch CV update, scheduled every CV_UPDATE_TICKS.
+ *
+ * Converts the latest pitch into DAC steps (only when it changed) and moves
+ * the output towards it by at most CV_SLEW_STEP per update (0 = jump).
+ * Only a changed output is handed to ISR(INT1_vect).
+ */
+void cv_task() {
+    if (cv_pitch_changed) {
+        cv_pitch_changed = false;
+        int16_t cv;
+        #if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG
+            // 819 DAC steps per octave (1V/Oct), the register shifts by whole octaves
+            int32_t log_freq = (int32_t)log2U16(cv_pitch) - ((int32_t)(cv_register - 1) << 12);
+            if (log_freq >= 37104) {
+                // 37104 = log2U16(512) + 48*4096/819
+                cv = (int16_t)((819 * (log_freq - 37104)) >> 12);
+            } else {
+                cv = 0;
+            }
+        #elif CV_OUTPUT_MODE == CV_OUTPUT_MODE_LINEAR
+            // 819Hz/V for Korg & Yamaha
+            cv = cv_pitch >> 2 >> (cv_register - 1);
+        #endif
+        cv_target = cv;
+    }
 
-    return (uint16_t)log_output;
+    int16_t cv = cv_target;
+    #if CV_SLEW_STEP > 0
+        if (cv_output >= 0) {
+            if (cv > cv_output + CV_SLEW_STEP) { cv = cv_output + CV_SLEW_STEP; }
+            else if (cv < cv_output - CV_SLEW_STEP) { cv = cv_output - CV_SLEW_STEP; }
+        }
+    #endif
+    if (cv == cv_output) { return; }
+    cv_output = cv;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        pitchCV = cv;
+        pitchCVAvailable = true;
+    }
 }
 #endif
@@ -1,13 +1,18 @@
-#include <Arduino.h>
+#include "../../platform.h"
+#include "../../build_options.h"
 
 #ifndef _CV_H_
 #define _CV_H_
 
 
-#if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG
-    uint16_t log2U16 (uint16_t lin_input);
+// pure math, built in every mode for the host replay and the cycle benchmark (dropped by the linker if unused)
+uint16_t log2U16 (uint16_t lin_input);
+
+#if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG || CV_OUTPUT_MODE == CV_OUTPUT_MODE_LINEAR
+    void cv_set_pitch(uint16_t clampedPitch, uint8_t reg);
+    void cv_task();
 #endif
 
 
 
-#endif // _CV_H_
\ No newline at end of file
+#endif // _CV_H_
@@ -81,6 +81,42 @@ static inline __attribute__((always_inline)) void SPImcpDACsend(uint16_t data12)
     // LDAC pulse stays at ISR start as you already do for stable timing
 }
 
+/*
+ * Software-pipelined audio DAC transmit, split in three steps so that the ISR
+ * can do useful work while each byte shifts out instead of spinning on SPIF:
+ *
+ *   SPImcpDACsendHigh(frame);   // CS low, high byte starts shifting
+ *   ...phase update, GATE...    // a byte takes 16 cycles to shift out at f_osc/2
+ *   SPImcpDACsendLow(frame);    // waits for the high byte, low byte starts shifting
+ *   ...pitch/volume debounce...
+ *   SPImcpDACsendDone();        // waits for the low byte, CS high
+ *
+ * no other SPI transfer may be started in between.
+ *
+ * ISR(INT1_vect) saving, estimated and NOT measured (no cycle report exists
+ * yet, check with DEBUG_DDS_ISR_BY_RED_LED or ISR_BENCHMARK): the two SPIF
+ * busy-waits of SPImcpDACtransmit() (est. ~2 x 18 cycles) are hidden behind
+ * the phase, GATE and debounce work, i.e. an estimated ~2 us per sample for
+ * both CV_OUTPUT_MODE_OFF and the CV enabled builds; the CV transfers to DAC3
+ * at the end of the ISR stay blocking since nothing is left to overlap them with.
+ */
+static inline __attribute__((always_inline)) void SPImcpDACsendHigh(uint16_t frame) {
+    MCP_DAC_CS_PORT &= ~_BV(MCP_DAC_CS_BIT);
+    SPDR = (uint8_t)(frame >> 8);
+}
+
+static inline __attribute__((always_inline)) void SPImcpDACsendLow(uint16_t frame) {
+    while (!(SPSR & _BV(SPIF))) {}
+    (void)SPDR; // clear SPIF properly
+    SPDR = (uint8_t)(frame & 0xFF);
+}
+
+static inline __attribute__((always_inline)) void SPImcpDACsendDone() {
+    while (!(SPSR & _BV(SPIF))) {}
+    (void)SPDR; // clear SPIF properly
+    MCP_DAC_CS_PORT |=  _BV(MCP_DAC_CS_BIT);
+}
+
 static inline void SPImcpDAC2Asend(uint16_t data) {
 	MCP_DAC2_CS_PORT &= ~_BV(MCP_DAC2_CS_BIT);
 	// Sanitize input data and add DAC config MSBs
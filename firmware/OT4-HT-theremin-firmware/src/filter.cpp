@@ -0,0 +1,75 @@
+#include "filter.h"
+#include "../../build_options.h"
+
+// input change per update (in counter ticks, as a power of two) above which
+// the adaptive filter starts opening its cutoff: 2^2 = 4 ticks
+#define FILTER_ADAPTIVE_SPEED_SHIFT 2
+#define FILTER_ADAPTIVE_MIN_SHIFT   1
+
+filter_t pitch_filter = { PITCH_FILTER_MODE, PITCH_FILTER_SHIFT, false, 0, 0, 0, 0 };
+filter_t volume_filter = { VOLUME_FILTER_MODE, VOLUME_FILTER_SHIFT, false, 0, 0, 0, 0 };
+
+void filter_set_mode(filter_t *f, uint8_t mode) {
+    if (mode > FILTER_MODE_ADAPTIVE) { return; }
+    f->mode = mode;
+    f->primed = false;  // restart from the next input, no transient from the old state
+}
+
+void filter_set_shift(filter_t *f, uint8_t shift) {
+    if (shift < 1 || shift > FILTER_MAX_SHIFT) { return; }
+    f->shift = shift;
+}
+
+/**
+ * @brief Feeds a new counter value into the filter and returns the smoothed value.
+ *
+ * - FILTER_MODE_EMA:      y += (x - y) / 2^shift, the original OpenTheremin smoothing (shift 2)
+ * - FILTER_MODE_TWO_POLE: two cascaded EMAs, steeper roll-off of the jitter for the same lag
+ * - FILTER_MODE_ADAPTIVE: one-euro style EMA, the shift is lowered by one for every doubling
+ *   of the input speed above 2^FILTER_ADAPTIVE_SPEED_SHIFT ticks per update, so fast
+ *   hand movements follow with little lag while held notes get the full smoothing.
+ *
+ * The state is kept with 8 fractional bits so long time constants don't truncate.
+ *
+ * @param f filter state
+ * @param x new raw counter value
+ * @return smoothed counter value
+ */
+int32_t filter_update(filter_t *f, int32_t x) {
+    const int32_t x8 = x << 8;
+    if (!f->primed) {
+        f->y1 = f->y2 = x8;
+        f->speed = 0;
+        f->x_l = x;
+        f->primed = true;
+        return x;
+    }
+
+    switch (f->mode) {
+        case FILTER_MODE_TWO_POLE:
+            f->y1 += (x8 - f->y1) >> f->shift;
+            f->y2 += (f->y1 - f->y2) >> f->shift;
+            return f->y2 >> 8;
+
+        case FILTER_MODE_ADAPTIVE: {
+            int32_t dx = x - f->x_l;
+            f->x_l = x;
+            if (dx < 0) { dx = -dx; }
+            f->speed += ((dx << 8) - f->speed) >> 2;    // smoothed speed, ~4 updates
+
+            uint8_t shift = f->shift;
+            uint32_t speed = (uint32_t)f->speed >> (8 + FILTER_ADAPTIVE_SPEED_SHIFT);
+            while (speed && shift > FILTER_ADAPTIVE_MIN_SHIFT) {
+                speed >>= 1;
+                shift--;
+            }
+            f->y1 += (x8 - f->y1) >> shift;
+            return f->y1 >> 8;
+        }
+
+        case FILTER_MODE_EMA:
+        default:
+            f->y1 += (x8 - f->y1) >> f->shift;
+            return f->y1 >> 8;
+    }
+}
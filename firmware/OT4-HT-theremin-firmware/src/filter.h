@@ -0,0 +1,29 @@
+#include "../../platform.h"
+
+#ifndef _FILTER_H_
+#define _FILTER_H_
+
+/**
+ * @brief State of a fixed-point smoothing filter for the pitch and volume counters.
+ *
+ * The mode is one of FILTER_MODE_EMA, FILTER_MODE_TWO_POLE or FILTER_MODE_ADAPTIVE
+ * (see build_options.h), the shift sets the time constant: 2^shift updates.
+ */
+typedef struct {
+    uint8_t mode;       // FILTER_MODE_xxx
+    uint8_t shift;      // EMA shift, i.e. the lowest cutoff of the adaptive mode
+    bool primed;        // false until the first input value
+    int32_t y1;         // first stage output, 24.8 fixed-point
+    int32_t y2;         // second stage output (two-pole), 24.8 fixed-point
+    int32_t speed;      // smoothed input change per update (adaptive), 24.8 fixed-point
+    int32_t x_l;        // last input value (adaptive)
+} filter_t;
+
+extern filter_t pitch_filter;
+extern filter_t volume_filter;
+
+void filter_set_mode(filter_t *f, uint8_t mode);
+void filter_set_shift(filter_t *f, uint8_t shift);
+int32_t filter_update(filter_t *f, int32_t x);
+
+#endif // _FILTER_H_
@@ -27,14 +27,20 @@
 #define GATE_DRIVE_HIGH         (DDRC |= (1<<PORTC2))
 #define GATE_DRIVE_LOW          (PORTC &= ~(1<<PORTC2)); (DDRC |= (1<<PORTC2))
 
+// MIDI_OUTPUT: MIDI OUT on the GATE pin, idle (and stop bit) high
+#define MIDI_TX_HIGH            (PORTC |= (1<<PORTC2))
+#define MIDI_TX_LOW             (PORTC &= ~(1<<PORTC2))
+
 #define PITCH_POT               0
 #define VOLUME_POT              1
 #define REGISTER_SELECT_POT     6
 #define WAVE_SELECT_POT         7
 
+// former fixed EEPROM layout, only read by settings_load() to migrate to the settings record
 #define EEPROM_PITCH_DAC_VOLTAGE_ADDRESS            0
 #define EEPROM_PITCH_DAC_CALIBRATION_BASE_ADDRESS   4
 #define EEPROM_VOLUME_DAC_VOLTAGE_ADDRESS           2
 #define EEPROM_VOLUME_DAC_CALIBRATION_BASE_ADDRESS  8
+#define EEPROM_VOLUME_CURVE_ADDRESS                 12
 
 #endif // _HW_H_
\ No newline at end of file
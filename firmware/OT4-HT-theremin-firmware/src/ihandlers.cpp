@@ -1,9 +1,21 @@
 #include "ihandlers.h"
+#include "../../build_options.h"
+#ifdef __AVR__
 #include "dac.h"
 #include "timer.h"
-#include "../../build_options.h"
 #include "hw.h"
+#include "benchmark.h"
+#include "midi.h"
+#endif
+
+#if defined(WAVEFORM_COMPRESSED) && defined(WAVEFORM_MIPMAPS)
+    #error "WAVEFORM_MIPMAPS needs the full tables, it can't be combined with WAVEFORM_COMPRESSED"
+#endif
 
+#ifdef WAVEFORM_COMPRESSED
+// 16 timbres in the formats of scripts/gen_wavetable_compressed.py, wavetables[] descriptors included
+#include "wavetable_compressed.h"
+#else
 #ifdef WAVEFORM_INCLUDE_PURE_SINE
 #include "wavetable_pure_sine1024.h"
 #endif
@@ -15,6 +27,9 @@
 #include "wavetable_5.h"
 #include "wavetable_6.h"
 #include "wavetable_7.h"
+#ifdef WAVEFORM_MIPMAPS
+#include "wavetable_mipmaps.h"
+#endif
 
 const int16_t *const wavetables[] = {
     #ifdef WAVEFORM_INCLUDE_PURE_SINE
@@ -29,11 +44,32 @@ const int16_t *const wavetables[] = {
         wavetable_6,
         wavetable_7,
 };
+#endif // WAVEFORM_COMPRESSED
 // number of included wavetables to adapt potentiometer hysteresis and range.
 const uint8_t num_wavetables = (sizeof(wavetables) / sizeof(wavetables[0]));
+static_assert(sizeof(wavetables) / sizeof(wavetables[0]) <= STATE_CMD_WAVEFORM_MAX, "more wavetables than STATE_CMD_WAVEFORM opcodes");
 
 #define DDS_WAVETABLE_RESOLUTION 0x3ff      // future expansion from 1024 to 2048 point wavetables
 
+#ifdef WAVEFORM_MIPMAPS
+// band-limited levels of each wavetable, same order as wavetables[]
+const int16_t *const *const wavetable_mipmaps[] PROGMEM = {
+    #ifdef WAVEFORM_INCLUDE_PURE_SINE
+        wavetable_sine1024_mipmap,
+    #endif
+        wavetable_0_mipmap,
+        wavetable_1_mipmap,
+        wavetable_2_mipmap,
+        wavetable_3_mipmap,
+        wavetable_4_mipmap,
+        wavetable_5_mipmap,
+        wavetable_6_mipmap,
+        wavetable_7_mipmap,
+};
+
+#define DDS_MIPMAP_BASE_INCREMENT 64        // one table sample per SAMPLE_CLK on the full 1024-point table
+#endif
+
 static const uint32_t MCP_DAC_BASE = 2048;  // middle-point offset for a 12 bit DAC (4096)
 
 #define F_VOL_PIN (PIND & (1 << PORTD2))
@@ -43,6 +79,7 @@ volatile uint16_t vScaledVolume = 0;        // output level amplitude
 volatile uint16_t vPointerIncrement = 0;    // phase accumulator increment
 
 volatile uint16_t pitch = 0;                // Pitch value
+volatile uint16_t pitch_raw = 0;            // Last single pitch period, before window averaging
 volatile uint16_t pitch_counter = 0;        // Pitch counter
 volatile uint16_t pitch_counter_l = 0;      // Last value of pitch counter
 
@@ -65,12 +102,328 @@ volatile uint8_t vWavetableSelector = 0;    // wavetable selector
 
 static volatile uint16_t pointer = 0;       // Table pointer 16-bit: 10 bits integer + 6 bits fraction
 
+#ifdef WAVEFORM_MIPMAPS
+// wavetable level played by the ISR, selected by setWavetableSampleAdvance(),
+// first by ihInitialiseTimer() for vWavetableSelector, before INT1 runs
+static const int16_t *volatile vMipWavetable = wavetables[0];
+static volatile uint8_t vMipLength = 0;     // length of the band-limited level (128..8), 0 = full 1024-point table
+#endif
+
 static volatile uint8_t debounce_p, debounce_v = 0; // Counters for debouncing
 
+static volatile uint16_t gateTicks = 0;     // remaining 1 ms ticks of the calibration gate
+static volatile uint8_t gateCounter = GATE_COUNTER_NONE; // counter stopped when the gate expires
+
+#if PITCH_MEASUREMENT_WINDOW == 1
+    #define PITCH_MEASUREMENT_WINDOW_SHIFT 0
+#elif PITCH_MEASUREMENT_WINDOW == 2
+    #define PITCH_MEASUREMENT_WINDOW_SHIFT 1
+#elif PITCH_MEASUREMENT_WINDOW == 4
+    #define PITCH_MEASUREMENT_WINDOW_SHIFT 2
+#elif PITCH_MEASUREMENT_WINDOW == 8
+    #define PITCH_MEASUREMENT_WINDOW_SHIFT 3
+#else
+    #error "PITCH_MEASUREMENT_WINDOW must be 1, 2, 4 or 8"
+#endif
+
+#if PITCH_MEASUREMENT_WINDOW > 1
+// moving window of the last pitch periods, the sum needs 32 bits (~23000 ticks per period)
+static uint16_t pitchWindow[PITCH_MEASUREMENT_WINDOW];
+static uint32_t pitchWindowSum = 0;
+static uint8_t pitchWindowIndex = 0;
+#endif
+
+#ifdef WAVEFORM_INTERPOLATION
+#define DDS_PHASE_FRACTION_MASK 0x3f        // 6 fractional bits of the 10.6 phase accumulator
+
+/**
+ * @brief Linear interpolation between two adjacent wavetable entries.
+ *
+ * Blends the sample at `offset` with the next one (wrapping at the table end)
+ * using the 6 fractional phase bits: s0 + (s1 - s0) * frac / 64.
+ * The difference of two 12-bit samples times a 6-bit fraction needs 19 bits,
+ * so the product is widened to 32 bits, which avr-gcc maps onto the hardware
+ * MUL instruction (16x16->32) rather than a software multiply.
+ *
+ * @param table  wavetable base address in PROGMEM
+ * @param offset integer part of the phase accumulator (table index)
+ * @param frac   6-bit fractional part of the phase accumulator
+ * @param mask   table length - 1, for the wrap-around of the next index
+ */
+static inline __attribute__((always_inline)) int16_t wavetable_interpolated_sample(const int16_t *table, uint16_t offset, uint8_t frac, uint16_t mask) {
+    int16_t s0 = (int16_t)pgm_read_word_near(table + offset);
+    int16_t s1 = (int16_t)pgm_read_word_near(table + ((offset + 1) & mask));
+    return s0 + (int16_t)(((int32_t)(s1 - s0) * frac) >> 6);
+}
+#endif
+
+#ifdef WAVEFORM_COMPRESSED
+/**
+ * @brief Reads sample `index` (0..1023) of a compressed wavetable.
+ *
+ * See scripts/gen_wavetable_compressed.py for the formats. Every format costs
+ * one or two PROGMEM reads plus a few ALU operations, no loop:
+ *   QUARTER   fold the index into 0..256, negate the second half
+ *   HALF      fold the index into 0..511, negate the second half
+ *   BLOCK8    int16 base of the 8-sample block + int8 offset
+ *   PACKED12  word at byte 3 * (index / 2) (+1 for odd), low or high 12 bits
+ */
+static inline __attribute__((always_inline)) int16_t wavetable_compressed_read(const wavetable_compressed_t *table, uint16_t index) {
+    switch (table->format) {
+        case WAVETABLE_FORMAT_QUARTER: {
+            uint16_t k = index & 0x1ff;
+            if (k > 256) { k = 512 - k; }
+            int16_t v = (int16_t)pgm_read_word_near((const int16_t *)table->data + k);
+            return (index & 0x200) ? -v : v;
+        }
+        case WAVETABLE_FORMAT_HALF: {
+            int16_t v = (int16_t)pgm_read_word_near((const int16_t *)table->data + (index & 0x1ff));
+            return (index & 0x200) ? -v : v;
+        }
+        case WAVETABLE_FORMAT_BLOCK8:
+            return (int16_t)pgm_read_word_near((const int16_t *)table->data + (index >> 3))
+                 + (int8_t)pgm_read_byte_near(table->offsets + index);
+        default: {  // WAVETABLE_FORMAT_PACKED12
+            uint16_t raw = pgm_read_word_near((const uint8_t *)table->data + (index >> 1) * 3 + (index & 1));
+            raw = (index & 1) ? (raw >> 4) : (raw & 0x0fff);
+            return (int16_t)raw - 2048;
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Fetches the wavetable sample for a 10.6 fixed-point phase.
+ *
+ * Plays the currently selected wavetable (or its band-limited level with WAVEFORM_MIPMAPS,
+ * or decodes it with WAVEFORM_COMPRESSED), nearest sample or linearly interpolated
+ * with WAVEFORM_INTERPOLATION.
+ * Shared by the INT1 ISR and the block renderer of AUDIO_BLOCK_PIPELINE.
+ *
+ * @param phase 16-bit phase accumulator: 10 bits integer + 6 bits fraction
+ */
+static inline __attribute__((always_inline)) int16_t wavetable_sample(uint16_t phase) {
+    // extract the fractional offset from the 10.6 fixed-point phase accumulator (pointer).
+    // Shifting by 6 matches the 64-step sub-sample precision — efficient and avoids floating-point.
+    uint16_t offset = (phase >> 6) & DDS_WAVETABLE_RESOLUTION; // 10-bit table index
+    int16_t waveSample;
+    #ifdef WAVEFORM_COMPRESSED
+    const wavetable_compressed_t *table = &wavetables[vWavetableSelector];
+    #ifdef WAVEFORM_INTERPOLATION
+        int16_t s0 = wavetable_compressed_read(table, offset);
+        int16_t s1 = wavetable_compressed_read(table, (offset + 1) & DDS_WAVETABLE_RESOLUTION);
+        waveSample = s0 + (int16_t)(((int32_t)(s1 - s0) * ((uint8_t)phase & DDS_PHASE_FRACTION_MASK)) >> 6);
+    #else
+        waveSample = wavetable_compressed_read(table, offset);
+    #endif
+    #else // WAVEFORM_COMPRESSED
+    #ifdef WAVEFORM_MIPMAPS
+    const int16_t *table = vMipWavetable;
+    uint8_t mipLength = vMipLength;
+    if (mipLength) {
+        // band-limited level: scale the 16-bit phase to the shorter table (16x8 multiply),
+        // the level index ends up in bits 16.., the 6-bit fraction in bits 10..15
+        uint32_t mipPhase = (uint32_t)phase * mipLength;
+        uint8_t mipOffset = (uint8_t)(mipPhase >> 16);
+        #ifdef WAVEFORM_INTERPOLATION
+            waveSample = wavetable_interpolated_sample(table, mipOffset, (uint8_t)(mipPhase >> 10) & DDS_PHASE_FRACTION_MASK, mipLength - 1);
+        #else
+            waveSample = (int16_t)pgm_read_word_near(table + mipOffset);
+        #endif
+    } else
+    #else
+    const int16_t *table = wavetables[vWavetableSelector];
+    #endif
+    {
+        #ifdef WAVEFORM_INTERPOLATION
+            waveSample = wavetable_interpolated_sample(table, offset, (uint8_t)phase & DDS_PHASE_FRACTION_MASK, DDS_WAVETABLE_RESOLUTION);
+        #else
+            waveSample = (int16_t)pgm_read_word_near(table + offset);
+        #endif
+    }
+    #endif // WAVEFORM_COMPRESSED
+    return waveSample;
+}
+
+
+/**
+ * @brief Wavetable sample of a phase, scaled by the volume and framed for the audio DAC.
+ *
+ * The per-sample math of ISR(INT1_vect) and of the block renderer.
+ */
+static inline __attribute__((always_inline)) uint16_t ih_audio_frame(uint16_t phase, uint16_t volume) {
+    int16_t waveSample = wavetable_sample(phase);
+    uint32_t scaledSample = ((int32_t)waveSample * (uint32_t)volume) >> 16;
+    return ((scaledSample + MCP_DAC_BASE) & 0x0FFF) | 0x7000;  // BUF=1, GA=1x, SHDN=1, channel A
+}
+
+/**
+ * @brief True if the phase update crossed a half-cycle of the table (index 0 or 512),
+ * i.e. the GATE square wave toggles: the table MSB is bit 15 of the 10.6 phase.
+ */
+static inline __attribute__((always_inline)) bool ih_gate_toggles(uint16_t phase, uint16_t next) {
+    return (phase ^ next) & 0x8000;
+}
+
+/**
+ * @brief Pitch period of a new Timer1 capture, averaged over PITCH_MEASUREMENT_WINDOW.
+ */
+static inline __attribute__((always_inline)) void ih_pitch_period(uint16_t capture) {
+    pitch_counter = capture;
+    uint16_t period = pitch_counter - pitch_counter_l;  // Counter change since last interrupt -> pitch period
+    pitch_counter_l = pitch_counter;                    // Set actual value as new last value
+    pitch_raw = period;
+    #if PITCH_MEASUREMENT_WINDOW > 1
+        pitchWindowSum += period;                       // Replace the oldest period in the moving window
+        pitchWindowSum -= pitchWindow[pitchWindowIndex];
+        pitchWindow[pitchWindowIndex] = period;
+        pitchWindowIndex = (pitchWindowIndex + 1) & (PITCH_MEASUREMENT_WINDOW - 1);
+        pitch = pitchWindowSum >> PITCH_MEASUREMENT_WINDOW_SHIFT; // Window average -> pitch value
+    #else
+        pitch = period;                                 // Single period -> pitch value
+    #endif
+}
+
+/**
+ * @brief Volume period of a new Timer1 stamp of the F_VOL edge.
+ */
+static inline __attribute__((always_inline)) void ih_volume_period(uint16_t capture) {
+    vol_counter = capture;
+    vol = (vol_counter - vol_counter_l);                // Counter change since last interrupt
+    vol_counter_l = vol_counter;                        // Set actual value as new last value
+}
 
 // DISPLAY UI FREQUENCY OUTPUT (GATE output)
+#ifdef AUDIO_BLOCK_PIPELINE
+static bool gateState = false;              // owned by the block renderer
+#else
 static volatile bool gateState = false;
+#endif
 
+#ifdef AUDIO_BLOCK_PIPELINE
+#define AUDIO_RING_SIZE 32                  // pre-framed DAC words, power of two (32 samples = 1 ms)
+#define AUDIO_RING_MASK (AUDIO_RING_SIZE - 1)
+#define AUDIO_RING_GATE_BIT IH_FRAME_GATE_BIT // GATE level travels in the DAC channel select bit (channel A = 0)
+
+// single-producer (loop) / single-consumer (ISR) ring, 8-bit indices are atomic on AVR
+static volatile uint16_t audioRing[AUDIO_RING_SIZE];
+static volatile uint8_t audioRingHead = 0;  // next slot written by ihRenderAudioBlock()
+static volatile uint8_t audioRingTail = 0;  // next slot played by the ISR
+#ifdef __AVR__
+static uint16_t audioLastFrame = 0x7000 | MCP_DAC_BASE; // replayed on underrun, by the ISR
+#endif
+static uint16_t renderPointer = 0;          // phase accumulator of the renderer
+volatile uint16_t audioUnderruns = 0;       // SAMPLE_CLK ticks without a rendered sample
+
+/**
+ * @brief Renders wavetable samples into the audio ring until it is full.
+ *
+ * Runs the work the ISR does in the default build (wavetable fetch, volume scaling,
+ * DAC framing, phase update and GATE square wave) from the main loop, so that
+ * ISR(INT1_vect) only has to latch and send the next pre-framed word.
+ *
+ * @note Must be called more often than every AUDIO_RING_SIZE samples (1 ms),
+ *       otherwise the ISR repeats the last word and counts an underrun.
+ */
+void ihRenderAudioBlock() {
+    uint8_t head = audioRingHead;
+    uint8_t space = (audioRingTail - head - 1) & AUDIO_RING_MASK;
+    if (!space) { return; }
+
+    const uint16_t increment = vPointerIncrement;
+    const uint16_t volume = vScaledVolume;
+    uint16_t phase = renderPointer;
+    bool gate = gateState;
+
+    while (space--) {
+        uint16_t prevPhase = phase;
+        uint16_t frame = ih_audio_frame(phase, volume);
+        phase += increment;
+
+        // same half-cycle test as the ISR
+        if (ih_gate_toggles(prevPhase, phase)) { gate = !gate; }
+        if (gate) { frame |= AUDIO_RING_GATE_BIT; }
+
+        audioRing[head] = frame;
+        head = (head + 1) & AUDIO_RING_MASK;
+        audioRingHead = head;               // publish sample by sample
+    }
+    renderPointer = phase;
+    gateState = gate;
+}
+#endif
+
+
+#ifdef WAVEFORM_MIPMAPS
+/**
+ * @brief Sets the phase increment and selects the matching band-limited wavetable level.
+ *
+ * Level L (1024 >> L samples) only holds harmonics below (512 >> L), so it can be played
+ * up to an increment of 64 << L without aliasing above the SAMPLE_CLK Nyquist frequency.
+ * Levels below WAVETABLE_MIPMAP_FIRST_LEVEL play the full table.
+ * The level is chosen here in the main loop, the ISR only loads the resulting table pointer.
+ *
+ * @param val 10.6 fixed-point phase increment per SAMPLE_CLK
+ */
+void setWavetableSampleAdvance(uint16_t val) {
+    uint8_t level = 0;
+    while (level < WAVETABLE_MIPMAP_LAST_LEVEL && val > ((uint16_t)DDS_MIPMAP_BASE_INCREMENT << level)) {
+        level++;
+    }
+
+    const int16_t *table;
+    uint8_t length;
+    if (level < WAVETABLE_MIPMAP_FIRST_LEVEL) {
+        table = wavetables[vWavetableSelector];
+        length = 0;
+    } else {
+        const int16_t *const *mipmap = (const int16_t *const *)pgm_read_ptr(&wavetable_mipmaps[vWavetableSelector]);
+        table = (const int16_t *)pgm_read_ptr(&mipmap[level - WAVETABLE_MIPMAP_FIRST_LEVEL]);
+        length = (DDS_WAVETABLE_RESOLUTION + 1) >> level;
+    }
+
+    // table and length must change together for the ISR
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        vMipWavetable = table;
+        vMipLength = length;
+        vPointerIncrement = val;
+    }
+}
+#endif
+
+/**
+ * @brief One sample of the default (unpipelined) ISR audio path, without the DAC transfer.
+ *
+ * Same math as ISR(INT1_vect): frame of the current phase, phase update and GATE state.
+ * For the host replay and the cycle benchmark, the boards use the ISR itself.
+ *
+ * @return DAC frame, the GATE level in IH_FRAME_GATE_BIT
+ */
+uint16_t ihAudioSample() {
+    const uint16_t phase = pointer;
+    uint16_t frame = ih_audio_frame(phase, vScaledVolume);
+    pointer = phase + vPointerIncrement;
+    if (ih_gate_toggles(phase, pointer)) { gateState = !gateState; }
+    return gateState ? (frame | IH_FRAME_GATE_BIT) : frame;
+}
+
+/**
+ * @brief A Timer1 capture of the F_PITCH edge, as taken by the ISR after the debounce.
+ */
+void ihPitchCapture(uint16_t capture) {
+    ih_pitch_period(capture);
+    pitchValueAvailable = true;
+}
+
+/**
+ * @brief A Timer1 stamp of the F_VOL edge, as taken by the ISR after the debounce.
+ */
+void ihVolumeCapture(uint16_t capture) {
+    ih_volume_period(capture);
+    volumeValueAvailable = true;
+}
+
+#ifdef __AVR__
 
 /**
  * @brief Initializes hardware timers used for pitch frequency measurement and system timing.
@@ -87,6 +440,7 @@ static volatile bool gateState = false;
  * @note
  * - Timer1 is configured to run without prescaling for maximum frequency resolution.
  * - The ICES1 bit ensures rising edge detection on ICP1 (PD5) VO_PITCH.
+ * - With WAVEFORM_MIPMAPS, the ISR gets the wavetable level of vWavetableSelector.
  * - No waveform output is enabled; timers are used strictly for counting.
  */
 void ihInitialiseTimer() {
@@ -129,6 +483,10 @@ void ihInitialiseTimer() {
      * - TOIE0: Enable Timer0 Overflow Interrupt (used by Arduino core)
      */
     TIMSK0 = 0x01; // Enable Timer0 overflow interrupt
+
+    #ifdef WAVEFORM_MIPMAPS
+        setWavetableSampleAdvance(vPointerIncrement);  // the level of the selected wavetable
+    #endif
 }
 
 /**
@@ -176,6 +534,7 @@ void ihInitialiseInterrupts() {
  *
  * Configuration:
  * - Disables external INT0 and INT1 (EIMSK = 0) for F_VOL and SAMPLE_CLK
+ * - With MIDI_OUTPUT, first sends the queued MIDI bytes out (midi_flush())
  * - Timer1 normal mode with no waveform generation (TCCR1A = 0) counter only
  * - Enables Timer1 Overflow Interrupt (used to measure longer periods)
  *
@@ -183,6 +542,9 @@ void ihInitialiseInterrupts() {
  *       increments a software counter to extend timing range beyond 16 bits.
  */
 void ihInitialisePitchMeasurement() {
+    #ifdef MIDI_OUTPUT
+        midi_flush();               // no MIDI byte cut off, the line idles high while INT1 is off
+    #endif
     reenableInt1 = false;
     EIMSK = 0;                      // Disable External Interrupts INT0 and INT1
     TCCR1A = 0;                     // Timer1 Normal Mode, no PWM or compare output
@@ -190,18 +552,19 @@ void ihInitialisePitchMeasurement() {
 }
 
 /**
- * @brief Configures Timer0 and Timer1 to perform volume oscillator measurement.
+ * @brief Configures Timer0 to perform volume oscillator measurement.
  *
  * This mode is used during calibration or diagnostics to capture the absolute frequency
  * of the volume RF oscillator (VO_VOL) using internal timers only.
  *
  * Configuration steps:
  * - Disables external interrupts (EIMSK = 0)
- * - Timer0 is used in Normal mode (TCCR0A = 0) and set to trigger compare-match interrupts.
- * - Timer1 is used as a free-running counter with prescaler 1024 to extend timing range.
+ * - Timer0 is used in Normal mode (TCCR0A = 0) and set to trigger compare-match interrupts
+ *   every 256 counts (OCR0A = 0xff) to extend the counting range.
+ * - Timer1 is stopped, the gate time is taken from Timer2 (see ihStartCalibrationGate()).
  *
- * Volume signal transitions (VO_VOL) are detected by checking TCNT1 in relation
- * to Timer0 Compare Match A (OCR0A), which generates periodic samples.
+ * Timer0 is clocked by VO_VOL on T0 while the gate is open, so millis() and delay()
+ * don't work until ihInitialiseTimer() restores it.
  *
  * @note This is distinct from regular volume gating via F_VOL/INT0 and is more suited
  *       for precise, absolute measurements when direct oscillator observation is required.
@@ -217,19 +580,79 @@ void ihInitialiseVolumeMeasurement() {
     OCR0A = 0xff;                   // Set Compare Match A value to max (255)
 
     TCCR1A = 0;                     // Timer1 Normal mode
-    TCCR1B = (1 << CS10) | (1 << CS12); // Prescaler = 1024 (clock = 15.625 kHz)
+    TCCR1B = 0;                     // Timer1 stopped, Timer2 provides the gate time
     TCCR1C = 0;                     // No forced compare
 }
 
+/**
+ * @brief Opens a calibration gate of the given length on Timer2.
+ *
+ * Timer2 runs in CTC mode at 16 MHz / 128 / 125 = 1 kHz and counts the gate down
+ * in its compare ISR. The selected oscillator counter is cleared and started here
+ * and stopped by the ISR when the gate expires, so the gate length is exact to the
+ * ISR latency (a few us) however late the main loop polls ihCalibrationGateExpired().
+ *
+ * - GATE_COUNTER_PITCH:  Timer1 clocked by VO_PITCH on T1, overflows in timer_overflow_counter
+ * - GATE_COUNTER_VOLUME: Timer0 clocked by VO_VOL on T0, 256-counts in timer_overflow_counter
+ * - GATE_COUNTER_NONE:   a plain non-blocking delay (oscillator settling)
+ *
+ * @param milliseconds gate length, 1..65535 ms
+ * @param counter GATE_COUNTER_xxx
+ * @note Call ihInitialisePitchMeasurement() / ihInitialiseVolumeMeasurement() first.
+ */
+void ihStartCalibrationGate(uint16_t milliseconds, uint8_t counter) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        gateTicks = milliseconds;
+        gateCounter = counter;
+        timer_overflow_counter = 0;
+        if (counter == GATE_COUNTER_PITCH) {
+            TCNT1 = 0;
+            TIFR1 = (1 << TOV1);
+            TCCR1B = (1 << CS12) | (1 << CS11) | (1 << CS10); // External clock on T1, rising edge
+        } else if (counter == GATE_COUNTER_VOLUME) {
+            TCNT0 = 0;
+            TIFR0 = (1 << OCF0A);
+            TCCR0B = (1 << CS02) | (1 << CS01) | (1 << CS00); // External clock on T0, rising edge
+        }
+        TCCR2A = (1 << WGM21);          // Timer2 CTC mode
+        OCR2A = 124;                    // 125 counts at 125 kHz = 1 ms
+        TCNT2 = 0;
+        TIFR2 = (1 << OCF2A);
+        TIMSK2 = (1 << OCIE2A);         // Enable Timer2 Compare Match A interrupt (TIMER2_COMPA_vect)
+        TCCR2B = (1 << CS22) | (1 << CS20); // Prescaler = 128
+    }
+}
+
+/**
+ * @brief Stops the calibration gate and its oscillator counter without waiting for it.
+ */
+void ihStopCalibrationGate() {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        TCCR2B = 0;
+        TIMSK2 = 0;
+        if (gateCounter == GATE_COUNTER_PITCH) { TCCR1B = 0; }
+        else if (gateCounter == GATE_COUNTER_VOLUME) { TCCR0B = 0; }
+        gateTicks = 0;
+    }
+}
+
+bool ihCalibrationGateExpired() {
+    return TIMSK2 == 0;     // cleared by TIMER2_COMPA_vect at the end of the gate
+}
+
 /**
  * @brief Main waveform interrupt handler triggered by SAMPLE_CLK (INT1).
  *
  * This ISR is invoked at the audio sample rate (31.25 kHz) and performs:
  * - DAC waveform update and pointer increment.
+ *   (nearest sample, or linear interpolation if WAVEFORM_INTERPOLATION is defined)
  * - Rising-edge detection of F_PITCH and F_VOL signals.
  * - Frequency capture using Timer1.
  * - CV output if enabled.
  *
+ * With AUDIO_BLOCK_PIPELINE the waveform is rendered ahead by ihRenderAudioBlock()
+ * and the ISR only sends the next pre-framed DAC word and the GATE level.
+ *
  * ## Signal Input Explanation
  * - `F_PITCH_STATE` reads pin PB0 (digital pin 8) — the F_PITCH signal after flip-flop.
  *     Defined as: `(PINB & (1 << PORTB0))` → true when PB0 is HIGH.
@@ -242,58 +665,94 @@ void ihInitialiseVolumeMeasurement() {
  *
  * - debounce method: 3-sample debounce followed by 2-sample confirmation.
  *
+ * The audio DAC transmit is software-pipelined (see SPImcpDACsendHigh() in dac.h):
+ * the phase update, GATE output and debounce run while the SPI bytes shift out.
+ *
  * Externaly generated 31250 Hz Interrupt for WAVE generator (32us) 
  * 16MHz / 512 (2^9) = 31250 SAMPLE_CLK PD3
  * 
  * @note Keep interrupt duration below sample period (~32 µs).
  */
 ISR(INT1_vect) {
+    #ifdef ISR_BENCHMARK
+        const uint16_t benchStart = benchmark_isr_begin();
+    #endif
     #ifdef DEBUG_DDS_ISR_BY_RED_LED
         HW_LED_RED_TOGGLE;
     #endif
     SPImcpDAClatch();                           // Latch previous DAC value before sending a new sample
+    #ifdef MIDI_OUTPUT
+        midi_tx_bit();                          // MIDI OUT on the GATE pin, one bit per SAMPLE_CLK
+    #endif
     //EIMSK &= ~ (1 << INT1);                     // Disable further external interrupts to prevent re-entry
     //interrupts();                               // Re-enable nested interrupts to allow counter 1 interrupts
 
-    // extract the fractional offset from the 10.6 fixed-point phase accumulator (pointer).
-    // Shifting by 6 matches the 64-step sub-sample precision — efficient and avoids floating-point.
-    uint16_t offset = (pointer >> 6) & DDS_WAVETABLE_RESOLUTION; // 10-bit table index
-    uint16_t prevPhase = offset; // store 10-bit phase before update for square-wave output (pitch detection frequency measurement from external display board)
+#ifdef AUDIO_BLOCK_PIPELINE
+    // pre-rendered by ihRenderAudioBlock() in the main loop: just play the next word
+    uint8_t tail = audioRingTail;
+    uint16_t frame;
+    if (tail != audioRingHead) {
+        frame = audioRing[tail];
+        audioRingTail = (tail + 1) & AUDIO_RING_MASK;
+        audioLastFrame = frame;
+    } else {
+        frame = audioLastFrame;
+        audioUnderruns++;
+    }
+    SPImcpDACsendHigh(frame & ~AUDIO_RING_GATE_BIT);        // Start sending the pre-framed word to the audio DAC
+    incrementTimer();                                       // Update 32us system timer tick
 
-    int16_t waveSample = (int16_t)pgm_read_word_near(wavetables[vWavetableSelector] + offset);
-    uint32_t scaledSample = ((int32_t)waveSample * (uint32_t)vScaledVolume) >> 16;
-    SPImcpDACsend(scaledSample + MCP_DAC_BASE);             // Send result to audio DAC (5.5 us)
-    pointer += vPointerIncrement;                           // Advance wavetable phase pointer
+    #ifndef MIDI_OUTPUT
+    if (frame & AUDIO_RING_GATE_BIT)
+        PORTC |= (1 << PC2);
+    else
+        PORTC &= ~(1 << PC2);
+    #endif
+    SPImcpDACsendLow(frame);                                // Low byte shifts out during the debounce below
+#else
+    const uint16_t phase = pointer;                         // phase before the update, for the square-wave output (pitch detection frequency measurement from external display board)
+    uint16_t frame = ih_audio_frame(phase, vScaledVolume);
+    SPImcpDACsendHigh(frame);                               // Start sending result to audio DAC, high byte shifts out during the phase update
+    pointer = phase + vPointerIncrement;                    // Advance wavetable phase pointer
     incrementTimer();                                       // Update 32us system timer tick
 
     // output a plain square wave phase and frequency synced with audio output for
     // external pitch frequency detection from external display board.
-    uint16_t currPhase = (pointer >> 6) & DDS_WAVETABLE_RESOLUTION;
-    if ((prevPhase < 512 && currPhase >= 512) || (prevPhase >= 512 && currPhase < 512)) {
+    #ifndef MIDI_OUTPUT
+    if (ih_gate_toggles(phase, pointer)) {
         gateState = !gateState;
         if (gateState)
             PORTC |= (1 << PC2);
         else
             PORTC &= ~(1 << PC2);
     }
+    #endif
+    SPImcpDACsendLow(frame);                                // Low byte shifts out during the debounce below
+#endif
 
     // PB0 == F_PITCH
     if (F_PITCH_PIN) { debounce_p++; }
     if (debounce_p == 3) {
-        //cli();
-        pitch_counter = ICR1;                               // Get Timer-Counter 1 value
-        pitch = pitch_counter - pitch_counter_l;            // Counter change since last interrupt -> pitch value
-        pitch_counter_l = pitch_counter;                    // Set actual value as new last value
-    } else if (debounce_p == 5) { pitchValueAvailable = true; }
+        ih_pitch_period(ICR1);                              // Timer-Counter 1 value of the F_PITCH edge
+    } else if (debounce_p == 5) {
+        pitchValueAvailable = true;
+        #ifdef ISR_BENCHMARK
+            benchmark_pitch_ready();
+        #endif
+    }
 
     // PD2 == F_VOL
     if (F_VOL_PIN) { debounce_v++; }
     if (debounce_v == 3) {
-        //cli();
-        vol_counter = vol_counter_i;                        // Get Timer-Counter 1 value
-        vol = (vol_counter - vol_counter_l);                // Counter change since last interrupt
-        vol_counter_l = vol_counter;                        // Set actual value as new last value
-    } else if (debounce_v == 5) { volumeValueAvailable = true; }
+        ih_volume_period(vol_counter_i);                    // Timer-Counter 1 value of the F_VOL edge
+    } else if (debounce_v == 5) {
+        volumeValueAvailable = true;
+        #ifdef ISR_BENCHMARK
+            benchmark_volume_ready();
+        #endif
+    }
+
+    SPImcpDACsendDone();                                    // Audio DAC word complete, release CS
     
     #if CV_OUTPUT_MODE != CV_OUTPUT_MODE_OFF
         if (pitchCVAvailable) {
@@ -315,6 +774,9 @@ ISR(INT1_vect) {
     #ifdef DEBUG_DDS_ISR_BY_RED_LED
         HW_LED_RED_TOGGLE;
     #endif
+    #ifdef ISR_BENCHMARK
+        benchmark_isr_end(benchStart);
+    #endif
 }
 
 /* VOLUME read - interrupt service routine for capturing volume counter value */
@@ -337,3 +799,15 @@ ISR(TIMER0_COMPA_vect) {
 ISR(TIMER1_OVF_vect) {
     timer_overflow_counter++;
 }
+
+/* Calibration gate time base, 1 ms */
+ISR(TIMER2_COMPA_vect) {
+    if (--gateTicks == 0) {
+        if (gateCounter == GATE_COUNTER_PITCH) { TCCR1B = 0; }          // Stop counting VO_PITCH
+        else if (gateCounter == GATE_COUNTER_VOLUME) { TCCR0B = 0; }    // Stop counting VO_VOL
+        TCCR2B = 0;
+        TIMSK2 = 0;
+    }
+}
+
+#endif // __AVR__
@@ -1,9 +1,11 @@
-#include <Arduino.h>
+#include "../../platform.h"
+#include "../../build_options.h"
 
 #ifndef _IHANDLERS_H_
 #define _IHANDLERS_H_
 
 extern volatile uint16_t pitch;                     // Pitch value
+extern volatile uint16_t pitch_raw;                 // Last single pitch period, before window averaging
 extern volatile uint16_t vol;                       // Volume value
 extern volatile uint16_t vScaledVolume;             // Volume byte
 extern volatile int16_t pitchCV;                    // Pitch CV value
@@ -27,11 +29,36 @@ extern const uint8_t num_wavetables;
 
 extern volatile uint16_t vPointerIncrement;         // Table pointer increment
 
-inline void setWavetableSampleAdvance(uint16_t val) { vPointerIncrement = val; }
+#ifdef WAVEFORM_MIPMAPS
+void setWavetableSampleAdvance(uint16_t val);       // also selects the band-limited wavetable level
+#else
+inline void setWavetableSampleAdvance(uint16_t val) { ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { vPointerIncrement = val; } }
+#endif
+
+#ifdef AUDIO_BLOCK_PIPELINE
+extern volatile uint16_t audioUnderruns;            // SAMPLE_CLK ticks without a rendered sample
+void ihRenderAudioBlock();
+#endif
+
+#define IH_FRAME_GATE_BIT   0x8000  // GATE level in a frame of ihAudioSample(), the DAC channel select bit
+
+// per-sample math of ISR(INT1_vect) without the hardware, for the host replay and the cycle benchmark
+uint16_t ihAudioSample();
+void ihPitchCapture(uint16_t capture);
+void ihVolumeCapture(uint16_t capture);
 
 void ihInitialiseTimer();
 void ihInitialiseInterrupts();
 void ihInitialisePitchMeasurement();
 void ihInitialiseVolumeMeasurement();
 
+// oscillator counter stopped by the calibration gate (Timer2) when it expires
+#define GATE_COUNTER_NONE   0   // plain delay, nothing is counted
+#define GATE_COUNTER_PITCH  1   // Timer1 counts VO_PITCH on T1 (PD5)
+#define GATE_COUNTER_VOLUME 2   // Timer0 counts VO_VOL on T0 (PD4)
+
+void ihStartCalibrationGate(uint16_t milliseconds, uint8_t counter);
+void ihStopCalibrationGate();
+bool ihCalibrationGateExpired();
+
 #endif // _IHANDLERS_H_
@@ -0,0 +1,152 @@
+#include "midi.h"
+
+#ifdef MIDI_OUTPUT
+
+#include "quantizer.h"
+
+#define MIDI_NOTE_ON            (0x90 | (MIDI_CHANNEL - 1))
+#define MIDI_CONTROL_CHANGE     (0xB0 | (MIDI_CHANNEL - 1))
+#define MIDI_PITCH_BEND         (0xE0 | (MIDI_CHANNEL - 1))
+#define MIDI_BEND_CENTER        8192
+#define MIDI_BEND_SPAN          ((int16_t)MIDI_BEND_RANGE << 8)    // bend range, 8.8 semitones
+#define MIDI_NOTE_NONE          0xFF
+#define MIDI_UPDATE_BYTES       9       // note off + pitch bend + note on, without running status
+
+static_assert(MIDI_CHANNEL >= 1 && MIDI_CHANNEL <= 16, "MIDI_CHANNEL must be 1..16");
+static_assert(MIDI_BEND_RANGE >= 1 && MIDI_BEND_RANGE <= 24, "MIDI_BEND_RANGE must be 1..24 semitones");
+static_assert(MIDI_UPDATE_BYTES < MIDI_TX_QUEUE_SIZE, "MIDI_TX_QUEUE_SIZE too small for an update");
+
+volatile uint8_t midiTxQueue[MIDI_TX_QUEUE_SIZE];
+volatile uint8_t midiTxHead = 0;
+volatile uint8_t midiTxTail = 0;
+uint16_t midiTxShift = 0;
+uint8_t midiTxBits = 0;
+
+static uint16_t midi_pitch = 0;         // last pitch of midi_set_pitch()
+static uint8_t midi_register = 2;       // last register of midi_set_pitch()
+static uint8_t midi_volume = 0;         // last volume of midi_set_volume(), 0..127
+
+static uint8_t midi_status = 0;         // running status, 0 = none sent yet
+static uint8_t midi_note = MIDI_NOTE_NONE;  // note sounding on the synth
+static uint16_t midi_bend = MIDI_BEND_CENTER;   // pitch bend last sent
+static uint8_t midi_cc = 0xFF;          // volume control last sent, 0xFF = none yet
+
+void midi_init() {
+    MIDI_TX_HIGH;                       // idle level, GATE_PIN is an output already
+}
+
+/**
+ * @brief Waits until the queued bytes are on the line, before ISR(INT1_vect) is stopped.
+ *
+ * The calibration disables INT1, a byte cut off there would leave the line
+ * low and the synth with a broken message. 16 bytes take 5 ms at most.
+ */
+void midi_flush() {
+    while (midiTxTail != midiTxHead || *(volatile uint8_t *)&midiTxBits != 0) {}
+}
+
+/**
+ * @brief Takes the clamped pitch of the main loop, converted by midi_task().
+ */
+void midi_set_pitch(uint16_t clampedPitch, uint8_t reg) {
+    midi_pitch = clampedPitch;
+    midi_register = reg;
+}
+
+/**
+ * @brief Takes the output volume of the main loop, 0..4095 (DAC_12BIT_MAX), 0 when muted.
+ */
+void midi_set_volume(uint16_t volume) {
+    midi_volume = volume >> 5;
+}
+
+static uint8_t midi_queue_free() {
+    return MIDI_TX_QUEUE_SIZE - 1 - ((midiTxHead - midiTxTail) & MIDI_TX_QUEUE_MASK);
+}
+
+static void midi_put(uint8_t b) {
+    const uint8_t head = midiTxHead;
+    midiTxQueue[head] = b;
+    midiTxHead = (head + 1) & MIDI_TX_QUEUE_MASK;   // one byte store, the ISR sees the byte complete
+}
+
+/**
+ * @brief Queues a channel message, the status byte only when it differs from the last one.
+ */
+static void midi_message(uint8_t status, uint8_t data1, uint8_t data2) {
+    if (status != midi_status) {
+        midi_put(status);
+        midi_status = status;
+    }
+    midi_put(data1);
+    midi_put(data2);
+}
+
+static void midi_send_bend(uint16_t bend) {
+    midi_message(MIDI_PITCH_BEND, bend & 0x7F, bend >> 7);
+    midi_bend = bend;
+}
+
+/**
+ * @brief Pitch bend to reach a 8.8 note number from the playing note.
+ */
+static uint16_t midi_bend_to(uint16_t note_number) {
+    int32_t bend = MIDI_BEND_CENTER + ((((int32_t)note_number - (int32_t)((uint16_t)midi_note << 8)) * 32) / MIDI_BEND_RANGE);
+    if (bend < 0) { bend = 0; }
+    if (bend > 16383) { bend = 16383; }
+    return (uint16_t)bend;
+}
+
+/**
+ * @brief MIDI update, scheduled every MIDI_UPDATE_TICKS.
+ *
+ * Sends note off / pitch bend / note on when a note starts, ends or the
+ * pitch leaves the bend range, else a changed pitch bend or volume control.
+ * That is 3 bytes per update at most, 9 on a new note, the line takes 6.25
+ * bytes per 2 ms. Waits while the queue can't take a whole update.
+ */
+void midi_task() {
+    if (midi_queue_free() < MIDI_UPDATE_BYTES) { return; }
+
+    const bool sounding = midi_volume > 0;
+    if (!sounding) {
+        if (midi_note != MIDI_NOTE_NONE) {
+            midi_message(MIDI_NOTE_ON, midi_note, 0);   // velocity 0: note off, keeps the running status
+            midi_note = MIDI_NOTE_NONE;
+        } else if (midi_cc != 0) {
+            midi_message(MIDI_CONTROL_CHANGE, MIDI_VOLUME_CC, 0);
+            midi_cc = 0;
+        }
+        return;
+    }
+
+    const uint16_t note_number = quantizer_note_number(midi_pitch, midi_register);
+    bool new_note = midi_note == MIDI_NOTE_NONE;
+    if (!new_note) {
+        const int16_t offset = (int16_t)note_number - (int16_t)((uint16_t)midi_note << 8);
+        new_note = offset >= MIDI_BEND_SPAN || offset <= -MIDI_BEND_SPAN;
+    }
+    if (new_note) {
+        // new note, the nearest one, started with its bend so it doesn't slide in
+        if (midi_note != MIDI_NOTE_NONE) {
+            midi_message(MIDI_NOTE_ON, midi_note, 0);
+        }
+        midi_note = (note_number + 128) >> 8;
+        const uint16_t bend = midi_bend_to(note_number);
+        if (bend != midi_bend) { midi_send_bend(bend); }
+        midi_message(MIDI_NOTE_ON, midi_note, MIDI_NOTE_VELOCITY);
+        return;
+    }
+
+    // bend and volume take turns while both change
+    const uint16_t bend = midi_bend_to(note_number);
+    const bool bend_changed = bend != midi_bend;
+    if (midi_volume != midi_cc && (!bend_changed || midi_status == MIDI_PITCH_BEND)) {
+        midi_message(MIDI_CONTROL_CHANGE, MIDI_VOLUME_CC, midi_volume);
+        midi_cc = midi_volume;
+    } else if (bend_changed) {
+        midi_send_bend(bend);
+    }
+}
+
+#endif // MIDI_OUTPUT
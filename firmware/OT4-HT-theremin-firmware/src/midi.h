@@ -0,0 +1,51 @@
+#include <Arduino.h>
+#include "../../build_options.h"
+#include "hw.h"
+
+#ifndef _MIDI_H_
+#define _MIDI_H_
+
+#ifdef MIDI_OUTPUT
+
+#define MIDI_TX_QUEUE_SIZE  16      // power of 2, bytes waiting for ISR(INT1_vect)
+#define MIDI_TX_QUEUE_MASK  (MIDI_TX_QUEUE_SIZE - 1)
+
+extern volatile uint8_t midiTxQueue[MIDI_TX_QUEUE_SIZE];
+extern volatile uint8_t midiTxHead;     // next free byte (loop only)
+extern volatile uint8_t midiTxTail;     // next byte to send (ISR only)
+extern uint16_t midiTxShift;            // frame being sent, LSB next (ISR only)
+extern uint8_t midiTxBits;              // bits of the frame left (ISR only)
+
+void midi_init();
+void midi_flush();
+void midi_set_pitch(uint16_t clampedPitch, uint8_t reg);
+void midi_set_volume(uint16_t volume);
+void midi_task();
+
+/**
+ * @brief Puts the next MIDI OUT bit on the pin, once per SAMPLE_CLK from ISR(INT1_vect).
+ *
+ * 8N1 frames: start bit, 8 data bits LSB first, stop bit. Called at the
+ * same point of every ISR run, so the bit edges keep the SAMPLE_CLK timing.
+ * ~8 cycles when idle, ~30 when sending.
+ */
+static inline __attribute__((always_inline)) void midi_tx_bit() {
+    if (midiTxBits == 0) {
+        const uint8_t tail = midiTxTail;
+        if (tail == midiTxHead) { return; }     // idle, the line stays high
+        midiTxShift = ((uint16_t)midiTxQueue[tail] << 1) | 0x200;
+        midiTxTail = (tail + 1) & MIDI_TX_QUEUE_MASK;
+        midiTxBits = 10;
+    }
+    if (midiTxShift & 1) {
+        MIDI_TX_HIGH;
+    } else {
+        MIDI_TX_LOW;
+    }
+    midiTxShift >>= 1;
+    midiTxBits--;
+}
+
+#endif // MIDI_OUTPUT
+
+#endif // _MIDI_H_
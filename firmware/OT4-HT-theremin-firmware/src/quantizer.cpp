@@ -0,0 +1,211 @@
+#include "quantizer.h"
+
+#if defined(PITCH_QUANTIZER) || defined(MIDI_OUTPUT)
+
+#include "quantizer_notes.h"
+
+/**
+ * @brief Index of the last table note <= key, note 0 below the table.
+ *
+ * Binary search, 7 steps of one PROGMEM word read for the 119 notes.
+ */
+static uint8_t quantizer_below(uint16_t key) {
+    uint8_t lo = 0;
+    uint8_t hi = QUANTIZER_NOTES - 1;
+    while (lo < hi) {
+        const uint8_t mid = (lo + hi + 1) >> 1;
+        if (pgm_read_word(&quantizer_notes[mid]) <= key) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
+#ifdef MIDI_OUTPUT
+/**
+ * @brief Pitch as a MIDI note number at A4 = 440 Hz, for MIDI_OUTPUT.
+ *
+ * The fraction is interpolated between the two table notes around the
+ * phase increment (linear in the increment, 0.7 cent off the exponential).
+ *
+ * @param pitch clamped pitch, 0..16383
+ * @param shift octave register, the phase increment is pitch >> shift
+ * @return note number, 8.8 fixed-point
+ */
+uint16_t quantizer_note_number(uint16_t pitch, uint8_t shift) {
+    const uint16_t key = ((uint32_t)pitch << QUANTIZER_NOTE_FRACTION_BITS) >> shift;
+    const uint8_t note = quantizer_below(key);
+    const uint16_t below = pgm_read_word(&quantizer_notes[note]);
+    if (note == QUANTIZER_NOTES - 1 || key <= below) { return (uint16_t)note << 8; }
+    const uint16_t above = pgm_read_word(&quantizer_notes[note + 1]);
+    return ((uint16_t)note << 8) + (uint16_t)(((uint32_t)(key - below) << 8) / (above - below));
+}
+#endif // MIDI_OUTPUT
+
+#endif // PITCH_QUANTIZER || MIDI_OUTPUT
+
+#ifdef PITCH_QUANTIZER
+
+/*
+ * The note table holds the phase increments at A4 = QUANTIZER_NOTES_CONCERT_A
+ * with QUANTIZER_NOTE_FRACTION_BITS fractional bits. The concert A ratio and
+ * the register shift are folded into two 16 bit factors per register when the
+ * concert A is set, so a search scales into the table and back with two 16x16
+ * bit multiplies and constant shifts:
+ *   key   = (pitch << fraction bits) * _key_scale >> 16
+ *   pitch = note * _pitch_scale >> QUANTIZER_PITCH_SCALE_BITS
+ * A search also finds the pitch range the note is nearest for. While the pitch
+ * stays within it, the usual case as the hand moves slowly against the updates,
+ * an update is two compares and the glide: no multiply, no table read.
+ */
+#define QUANTIZER_REGISTER_MIN  1       // shifts with 16 bit factors, ui.cpp selects 1..3
+#define QUANTIZER_REGISTER_MAX  4
+#define QUANTIZER_REGISTERS     (QUANTIZER_REGISTER_MAX - QUANTIZER_REGISTER_MIN + 1)
+#define QUANTIZER_KEY_SCALE_BITS   16
+#define QUANTIZER_PITCH_SCALE_BITS 13
+#define QUANTIZER_NOTE_PITCH_BITS  8    // fractional bits of the note followed
+#define QUANTIZER_PITCH_MAX     16383
+#define QUANTIZER_CONCERT_A_MIN 300     // same bounds as the display
+#define QUANTIZER_CONCERT_A_MAX 600
+#define QUANTIZER_STRENGTH_SHIFT 3
+static_assert((1 << QUANTIZER_STRENGTH_SHIFT) == QUANTIZER_STRENGTH_MAX, "QUANTIZER_STRENGTH_MAX must be 2^QUANTIZER_STRENGTH_SHIFT");
+// the largest factors, register 1 at 300 Hz and register 4 at 600 Hz, must fit 16 bits
+static_assert(((uint32_t)QUANTIZER_NOTES_CONCERT_A << (QUANTIZER_KEY_SCALE_BITS - QUANTIZER_REGISTER_MIN)) / QUANTIZER_CONCERT_A_MIN <= 0xFFFF, "key scale overflow");
+static_assert(((uint32_t)QUANTIZER_CONCERT_A_MAX << (QUANTIZER_PITCH_SCALE_BITS - QUANTIZER_NOTE_FRACTION_BITS + QUANTIZER_REGISTER_MAX)) / QUANTIZER_NOTES_CONCERT_A <= 0xFFFF, "pitch scale overflow");
+
+static uint8_t _strength = QUANTIZER_STRENGTH_DEFAULT;
+static uint8_t _glide = QUANTIZER_GLIDE_DEFAULT;
+static uint16_t _key_scale[QUANTIZER_REGISTERS];    // concert A -> table, per register
+static uint16_t _pitch_scale[QUANTIZER_REGISTERS];  // table -> concert A, per register
+static uint8_t _top[QUANTIZER_REGISTERS];           // highest note within QUANTIZER_PITCH_MAX
+static uint8_t _held_reg = QUANTIZER_REGISTERS;     // register of the held note, none yet
+static uint16_t _held_low;      // pitch range the held note is nearest for
+static uint16_t _held_high;
+static int32_t _held_pitch;     // held note, pitch units, 24.8 fixed-point
+static bool _primed = false;
+static int32_t _note_pitch;     // note followed, pitch units, 24.8 fixed-point
+
+static uint16_t quantizer_key(uint16_t pitch, uint8_t reg) {
+    return ((uint32_t)(pitch << QUANTIZER_NOTE_FRACTION_BITS) * _key_scale[reg]) >> QUANTIZER_KEY_SCALE_BITS;
+}
+
+static uint32_t quantizer_note_pitch(uint8_t note, uint8_t reg) {
+    return ((uint32_t)pgm_read_word(&quantizer_notes[note]) * _pitch_scale[reg])
+        >> (QUANTIZER_PITCH_SCALE_BITS - QUANTIZER_NOTE_PITCH_BITS);
+}
+
+void quantizer_init() {
+    quantizer_set_concert_a(QUANTIZER_NOTES_CONCERT_A);
+}
+
+void quantizer_set_strength(uint8_t strength) {
+    if (strength > QUANTIZER_STRENGTH_MAX) { return; }
+    _strength = strength;
+    _primed = false;    // start off the current note, no glide from an old one
+}
+
+void quantizer_set_glide(uint8_t glide) {
+    if (glide > QUANTIZER_GLIDE_MAX) { return; }
+    _glide = glide;
+}
+
+void quantizer_set_concert_a(uint16_t hz) {
+    if (hz < QUANTIZER_CONCERT_A_MIN || hz > QUANTIZER_CONCERT_A_MAX) { return; }
+    for (uint8_t reg = 0; reg < QUANTIZER_REGISTERS; reg++) {
+        const uint8_t shift = reg + QUANTIZER_REGISTER_MIN;
+        _key_scale[reg] = (uint16_t)(((uint32_t)QUANTIZER_NOTES_CONCERT_A << (QUANTIZER_KEY_SCALE_BITS - shift)) / hz);
+        _pitch_scale[reg] = (uint16_t)(((uint32_t)hz << (QUANTIZER_PITCH_SCALE_BITS - QUANTIZER_NOTE_FRACTION_BITS + shift)) / QUANTIZER_NOTES_CONCERT_A);
+        uint8_t top = QUANTIZER_NOTES - 1;
+        while (top > 0 && quantizer_note_pitch(top, reg) > ((uint32_t)QUANTIZER_PITCH_MAX << QUANTIZER_NOTE_PITCH_BITS)) { top--; }
+        _top[reg] = top;
+    }
+    _held_reg = QUANTIZER_REGISTERS;    // the held range is in the old factors
+}
+
+/**
+ * @brief Twice the midpoint between a table note and the note above.
+ *
+ * The midpoint is taken linearly (0.7 cent off the geometric one),
+ * a value on the midpoint stays with the lower note.
+ */
+static uint32_t quantizer_mid2(uint8_t note) {
+    return (uint32_t)pgm_read_word(&quantizer_notes[note]) + pgm_read_word(&quantizer_notes[note + 1]);
+}
+
+/**
+ * @brief Index of the table note nearest to a table value, at most top.
+ *
+ * The note above top would go past QUANTIZER_PITCH_MAX and be clamped off
+ * the note, so a value beyond top gets top.
+ */
+static uint8_t quantizer_nearest(uint16_t key, uint8_t top) {
+    uint8_t n = quantizer_below(key);
+    if (n >= top) { return top; }
+    if (((uint32_t)key << 1) > quantizer_mid2(n)) { n++; }
+    return n;
+}
+
+/**
+ * @brief Lowest pitch whose table value is above mid2 / 2, QUANTIZER_PITCH_MAX + 1 if none.
+ *
+ * Scaled back from the table, then corrected by a step or two through
+ * quantizer_key() for the rounding of the factors.
+ */
+static uint16_t quantizer_pitch_above(uint32_t mid2, uint8_t reg) {
+    uint32_t p = ((mid2 >> 1) * _pitch_scale[reg]) >> QUANTIZER_PITCH_SCALE_BITS;
+    if (p > QUANTIZER_PITCH_MAX) { p = QUANTIZER_PITCH_MAX + 1; }
+    while (p > 0 && ((uint32_t)quantizer_key(p - 1, reg) << 1) > mid2) { p--; }
+    while (p <= QUANTIZER_PITCH_MAX && ((uint32_t)quantizer_key(p, reg) << 1) <= mid2) { p++; }
+    return (uint16_t)p;
+}
+
+/**
+ * @brief Finds the note nearest to a pitch, its pitch and the range it is nearest for.
+ */
+static void quantizer_hold(uint16_t pitch, uint8_t reg) {
+    const uint8_t top = _top[reg];
+    const uint8_t note = quantizer_nearest(quantizer_key(pitch, reg), top);
+    _held_low = note == 0 ? 0 : quantizer_pitch_above(quantizer_mid2(note - 1), reg);
+    _held_high = note == top ? QUANTIZER_PITCH_MAX : quantizer_pitch_above(quantizer_mid2(note), reg) - 1;
+    _held_pitch = (int32_t)quantizer_note_pitch(note, reg);
+    _held_reg = reg;
+}
+
+/**
+ * @brief Pulls a clamped pitch value towards the nearest equal-tempered note.
+ *
+ * @param pitch clamped pitch, 0..16383
+ * @param shift octave register, the phase increment is pitch >> shift
+ * @return quantized pitch, 0..16383, pitch unchanged outside shifts 1..4
+ */
+uint16_t quantizer_update(uint16_t pitch, uint8_t shift) {
+    if (_strength == 0 || shift < QUANTIZER_REGISTER_MIN || shift > QUANTIZER_REGISTER_MAX) { return pitch; }
+    const uint8_t reg = shift - QUANTIZER_REGISTER_MIN;
+    if (reg != _held_reg || pitch < _held_low || pitch > _held_high) {
+        quantizer_hold(pitch, reg);     // the pitch left the held note
+    }
+
+    if (!_primed) {
+        _note_pitch = _held_pitch;
+        _primed = true;
+    } else if (_note_pitch != _held_pitch) {
+        const int32_t step = (_held_pitch - _note_pitch) >> _glide;
+        if (step == 0) {
+            _note_pitch = _held_pitch;  // the last fraction of a pitch unit
+        } else {
+            _note_pitch += step;
+        }
+    }
+
+    const uint16_t note_pitch = (uint16_t)(_note_pitch >> QUANTIZER_NOTE_PITCH_BITS);
+    if (_strength == QUANTIZER_STRENGTH_MAX) { return note_pitch; }     // hard snap, within 0..16383
+    const int16_t delta = (int16_t)note_pitch - (int16_t)pitch;
+    int32_t out = pitch + (((int32_t)delta * _strength) >> QUANTIZER_STRENGTH_SHIFT);
+    if (out < 0) { out = 0; }
+    if (out > QUANTIZER_PITCH_MAX) { out = QUANTIZER_PITCH_MAX; }
+    return (uint16_t)out;
+}
+
+#endif // PITCH_QUANTIZER
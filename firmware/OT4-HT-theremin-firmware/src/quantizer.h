@@ -0,0 +1,28 @@
+#include "../../platform.h"
+#include "../../build_options.h"
+
+#ifndef _QUANTIZER_H_
+#define _QUANTIZER_H_
+
+#ifdef PITCH_QUANTIZER
+
+/**
+ * @brief Pitch quantizer (assisted intonation), see PITCH_QUANTIZER in build_options.h.
+ *
+ * Works on the clamped pitch of loop() (0..16383), the phase increment of
+ * the wave generator is that value >> register. quantizer_init() sets up the
+ * factors of the default concert A and runs once in setup().
+ */
+void quantizer_init();
+void quantizer_set_strength(uint8_t strength);
+void quantizer_set_glide(uint8_t glide);
+void quantizer_set_concert_a(uint16_t hz);
+uint16_t quantizer_update(uint16_t pitch, uint8_t shift);
+
+#endif // PITCH_QUANTIZER
+
+#ifdef MIDI_OUTPUT
+uint16_t quantizer_note_number(uint16_t pitch, uint8_t shift);
+#endif
+
+#endif // _QUANTIZER_H_
@@ -0,0 +1,32 @@
+/* Pitch quantizer notes - generated by scripts/gen_quantizer_notes.py, do not edit.
+ * index: MIDI note, value: DDS phase increment at A4 = 440 Hz, 2 fractional bits
+ */
+
+#ifndef QUANTIZER_NOTES_H
+#define QUANTIZER_NOTES_H
+
+#include <avr/pgmspace.h>
+
+#define QUANTIZER_NOTES                 119
+#define QUANTIZER_NOTES_CONCERT_A       440
+#define QUANTIZER_NOTE_FRACTION_BITS    2
+
+const uint16_t quantizer_notes[QUANTIZER_NOTES] PROGMEM = {
+       69,    73,    77,    82,    86,    92,    97,   103,
+      109,   115,   122,   129,   137,   145,   154,   163,
+      173,   183,   194,   206,   218,   231,   244,   259,
+      274,   291,   308,   326,   346,   366,   388,   411,
+      435,   461,   489,   518,   549,   581,   616,   652,
+      691,   732,   776,   822,   871,   923,   978,  1036,
+     1097,  1163,  1232,  1305,  1383,  1465,  1552,  1644,
+     1742,  1845,  1955,  2071,  2195,  2325,  2463,  2610,
+     2765,  2930,  3104,  3288,  3484,  3691,  3910,  4143,
+     4389,  4650,  4927,  5220,  5530,  5859,  6207,  6577,
+     6968,  7382,  7821,  8286,  8779,  9301,  9854, 10440,
+    11060, 11718, 12415, 13153, 13935, 14764, 15642, 16572,
+    17557, 18601, 19708, 20879, 22121, 23436, 24830, 26306,
+    27871, 29528, 31284, 33144, 35115, 37203, 39415, 41759,
+    44242, 46873, 49660, 52613, 55741, 59056, 62567,
+};
+
+#endif // QUANTIZER_NOTES_H
@@ -0,0 +1,99 @@
+#include "scheduler.h"
+#include "timer.h"
+
+#define SCHEDULER_NONE          0xFF
+
+static const scheduler_task_t *scheduler_tasks = NULL;
+static uint8_t scheduler_count = 0;
+static uint32_t scheduler_due[SCHEDULER_MAX_TASKS];     // readTimer() of the next run of a periodic task
+#ifdef ISR_BENCHMARK
+static uint16_t scheduler_worst[SCHEDULER_MAX_TASKS];   // longest run in timer ticks since the last scheduler_print()
+static uint32_t scheduler_runs[SCHEDULER_MAX_TASKS];    // runs since the last scheduler_print()
+#endif
+
+/**
+ * @brief Takes over the task table, all periodic tasks are due at the first pass.
+ */
+void scheduler_init(const scheduler_task_t *tasks, uint8_t count) {
+    if (count > SCHEDULER_MAX_TASKS) { count = SCHEDULER_MAX_TASKS; }
+    uint32_t now = readTimer();
+    for (uint8_t i = 0; i < count; i++) {
+        scheduler_due[i] = now;
+    }
+    scheduler_tasks = tasks;
+    scheduler_count = count;
+}
+
+#ifdef ISR_BENCHMARK
+static inline void scheduler_account(uint8_t i, uint32_t start) {
+    uint32_t ticks = ticksSince(start);
+    if (ticks > scheduler_worst[i]) { scheduler_worst[i] = (ticks > 0xFFFF) ? 0xFFFF : ticks; }
+    scheduler_runs[i]++;
+}
+#endif
+
+/**
+ * @brief Earliest due periodic task, SCHEDULER_NONE if none is due yet.
+ *
+ * The longest waiting task wins regardless of its table position, so a
+ * short-period task that is due on every pass cannot starve the others:
+ * their lateness grows until it exceeds the short task's.
+ */
+static uint8_t scheduler_next(uint32_t now) {
+    uint8_t next = SCHEDULER_NONE;
+    int32_t next_late = -1;
+    for (uint8_t i = 0; i < scheduler_count; i++) {
+        if (scheduler_tasks[i].period == 0) { continue; }
+        int32_t late = (int32_t)(now - scheduler_due[i]);
+        if (late > next_late) {
+            next = i;
+            next_late = late;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief One pass over the task table, called from loop().
+ *
+ * Every period 0 task is run, of the periodic tasks only the earliest due
+ * one: the time between two polls of the pitch and volume tasks is bounded
+ * by the longest single periodic task instead of the sum of all, and a due
+ * task waits at most one pass per periodic task due before it.
+ * A task falling behind by more than one period skips the missed runs.
+ */
+void scheduler_run() {
+    const uint8_t next = scheduler_next(readTimer());
+    for (uint8_t i = 0; i < scheduler_count; i++) {
+        const scheduler_task_t *task = &scheduler_tasks[i];
+        uint32_t now = readTimer();
+        if (task->period != 0) {
+            if (i != next) { continue; }
+            scheduler_due[i] += task->period;
+            if ((int32_t)(now - scheduler_due[i]) >= 0) { scheduler_due[i] = now + task->period; }
+        }
+        task->run();
+        #ifdef ISR_BENCHMARK
+            scheduler_account(i, now);
+        #endif
+    }
+}
+
+#ifdef ISR_BENCHMARK
+/**
+ * @brief Prints and restarts the task counters, part of the STATE_CMD_DIAGNOSTICS answer:
+ *
+ *   TASK <index> runs=<count> worst=<ticks>
+ *
+ * in table order, worst is the longest run in timer ticks (32 us).
+ */
+void scheduler_print() {
+    for (uint8_t i = 0; i < scheduler_count; i++) {
+        Serial.print(F("TASK ")); Serial.print(i);
+        Serial.print(F(" runs=")); Serial.print(scheduler_runs[i]);
+        Serial.print(F(" worst=")); Serial.println(scheduler_worst[i]);
+        scheduler_runs[i] = 0;
+        scheduler_worst[i] = 0;
+    }
+}
+#endif
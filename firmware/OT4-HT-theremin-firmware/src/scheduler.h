@@ -0,0 +1,27 @@
+#include <Arduino.h>
+#include "../../build_options.h"
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#define SCHEDULER_MAX_TASKS     12
+
+/**
+ * @brief One entry of the static task table of scheduler_run().
+ *
+ * Tasks with period 0 are polled on every pass and check their own
+ * data-ready flag, the others run every `period` timer ticks (32 us).
+ */
+typedef struct {
+    void (*run)();          // task body, must not block
+    uint16_t period;        // timer ticks between runs, 0 = every pass
+} scheduler_task_t;
+
+void scheduler_init(const scheduler_task_t *tasks, uint8_t count);
+void scheduler_run();
+
+#ifdef ISR_BENCHMARK
+void scheduler_print();
+#endif
+
+#endif // _SCHEDULER_H_
@@ -0,0 +1,23 @@
+#include "settings.h"
+#include "hw.h"
+
+settings_store_t settings;
+
+/**
+ * @brief Reads the settings record, once at boot before anything uses settings.data.
+ *
+ * Without a valid record (blank EEPROM or the first boot of this firmware)
+ * the values at the former fixed addresses of hw.h are taken over and written
+ * as the first record, so a calibration survives the update.
+ * The values are range checked by their users.
+ */
+void settings_load() {
+    if (settings.load()) { return; }
+
+    EEPROM.get(EEPROM_PITCH_DAC_VOLTAGE_ADDRESS, settings.data.pitchDAC);
+    EEPROM.get(EEPROM_VOLUME_DAC_VOLTAGE_ADDRESS, settings.data.volumeDAC);
+    EEPROM.get(EEPROM_PITCH_DAC_CALIBRATION_BASE_ADDRESS, settings.data.pitchCalibrationBase);
+    EEPROM.get(EEPROM_VOLUME_DAC_CALIBRATION_BASE_ADDRESS, settings.data.volCalibrationBase);
+    EEPROM.get(EEPROM_VOLUME_CURVE_ADDRESS, settings.data.volumeCurve);
+    settings.save();
+}
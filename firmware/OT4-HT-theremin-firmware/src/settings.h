@@ -0,0 +1,28 @@
+#include <Arduino.h>
+#include "../../eeprom.h"
+
+#ifndef _SETTINGS_H_
+#define _SETTINGS_H_
+
+#define SETTINGS_EEPROM_BASE    0x20    // after the former fixed addresses (hw.h), read once for the migration
+#define SETTINGS_SLOTS          16      // 16 x 17 bytes, each cell is written once per 16 saves
+#define SETTINGS_VERSION        1
+
+/**
+ * @brief Persistent settings of the theremin, one EESettings record.
+ */
+typedef struct {
+    int16_t pitchDAC;               // VO_PITCH DAC value of the last calibration, -1 if none
+    int16_t volumeDAC;              // VO_VOL DAC value of the last calibration, -1 if none
+    int32_t pitchCalibrationBase;   // pitch counter with the hands away
+    int32_t volCalibrationBase;     // volume counter with the hands away
+    uint8_t volumeCurve;            // index into volume_curves
+} settings_t;
+
+typedef EESettings<settings_t, SETTINGS_EEPROM_BASE, SETTINGS_SLOTS, SETTINGS_VERSION> settings_store_t;
+
+extern settings_store_t settings;
+
+void settings_load();
+
+#endif // _SETTINGS_H_
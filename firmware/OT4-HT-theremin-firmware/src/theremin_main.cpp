@@ -3,45 +3,47 @@
 #include "dac.h"
 #include "ihandlers.h"
 #include "timer.h"
-#include "eeprom.h"
+#include "settings.h"
 #include "hw.h"
 #include "ui.h"
 #include "calibration.h"
 #include "cv.h"
+#include "volume_curves.h"
+#include "filter.h"
+#include "quantizer.h"
+#include "midi.h"
+#include "benchmark.h"
+#include "scheduler.h"
+#include "../../link_protocol.h"
+#include <util/atomic.h>
 
-void setup() {
-    Serial.begin(SERIAL_SPEED);
-
-    pinMode(BUTTON_PIN, INPUT_PULLUP);
-    pinMode(LED_BLUE_PIN, OUTPUT);
-    pinMode(LED_RED_PIN, OUTPUT);
-    pinMode(GATE_PIN, OUTPUT);
+/*
+ * Every value shared with ISR(INT1_vect) wider than 8 bit is read or written
+ * inside an ATOMIC_BLOCK, the AVR moves it one byte at a time and the ISR
+ * could otherwise update it half-way. The 8-bit flags tell when the ISR
+ * has a new value, so the loop doesn't depend on the optimization level.
+ */
 
-    ui_initialize();
-
-    calibration_read();
-    ihInitialiseTimer();
-    ihInitialiseInterrupts();
-
-    DEBUG_PRINTLN("Hello, Theremin world!");
-}
-
-void loop() {
-    int32_t pitch_v = 0;    // averaged pitch counter value
-    int32_t pitch_l = 0;    // stored pitch counter value
-    
-    int32_t vol_v = 0;      // averaged volume counter value
-    int32_t vol_l = 0;      // stored volume counter value
-
-    int32_t clampedVol;     // clamped volume amplitude
+/**
+ * @brief Pitch processing: filter, clamp, phase increment and pitch CV.
+ *
+ * Polled on every scheduler pass, does nothing until the ISR has a new pitch value.
+ */
+static void pitch_task() {
+    int32_t pitch_v;        // averaged pitch counter value
     int32_t clampedPitch;   // clamped pitch for phase accumulator
 
-mloop: // Main loop avoiding the GCC "optimization"
-
     if (pitchValueAvailable) {
-        // --- Smooth pitch value (simple IIR low-pass filter) ---
-        pitch_v = pitch_l + ((pitch - pitch_l) >> 2); // (low-pass) exponential moving average (EMA) approximation 75% previous, 25% new
-        pitch_l = pitch_v;
+        // --- Smooth pitch value (EMA, two-pole or adaptive low-pass filter, see PITCH_FILTER_MODE) ---
+        uint16_t pitchSample;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { pitchSample = pitch; }
+        #ifdef ISR_BENCHMARK
+            benchmark_pitch_used();
+        #endif
+        #ifdef CALIBRATION_DRIFT_TRACKING
+            if (theremin_is_muted()) { calibration_track_pitch(pitchSample); }   // used once the readings settled, see calibration.cpp
+        #endif
+        pitch_v = filter_update(&pitch_filter, pitchSample);
         /*
         ((int32_t)pitchPotValue << 1)   // for half sensitivity
         ((int32_t)pitchPotValue << 3)   // for double sensitivity
@@ -69,39 +71,45 @@ mloop: // Main loop avoiding the GCC "optimization"
             // - It fits well with common 10.6 fixed-point formats.
             clampedPitch = 16383;
         }
+        #ifdef PITCH_QUANTIZER
+            clampedPitch = quantizer_update((uint16_t)clampedPitch, registerValue);  // assisted intonation
+        #endif
         setWavetableSampleAdvance((uint16_t)clampedPitch >> registerValue);
         
         #if CV_OUTPUT_MODE != CV_OUTPUT_MODE_OFF
-            if (clampedPitch != pitch_p) { 
-                // output new pitch CV value only if pitch value changed (saves runtime resources)
-                pitch_p = clampedPitch;
-                #if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG
-                    log_freq = log2U16((uint16_t)clampedPitch);
-                    if (log_freq >= 37104) {
-                        // 37104 = log2U16(512) + 48*4096/819
-                        pitchCV = (int16_t)((819 * (log_freq - 37104)) >> 12);
-                        pitchCV >>= registerValue - 1;
-                    } else {
-                        pitchCV = 0;
-                    }
-                #elif CV_OUTPUT_MODE == CV_OUTPUT_MODE_LINEAR
-                    // 819Hz/V for Korg & Yamaha
-                    pitchCV = clampedPitch >> 2 >> (registerValue - 1);
-                #endif
-                pitchCVAvailable = true;
-            }
+            cv_set_pitch((uint16_t)clampedPitch, registerValue);    // the CV is updated by cv_task()
+        #endif
+        #ifdef MIDI_OUTPUT
+            midi_set_pitch((uint16_t)clampedPitch, registerValue);  // sent by midi_task()
         #endif
         pitchValueAvailable = false;  // consume the flag
     }
+}
+
+/**
+ * @brief Volume processing: filter, scale, volume curve and volume CV.
+ *
+ * Polled on every scheduler pass, does nothing until the ISR has a new volume value.
+ */
+static void volume_task() {
+    int32_t vol_v;          // averaged volume counter value
+    int32_t clampedVol;     // clamped volume amplitude
 
     if (volumeValueAvailable) {
         // Average and clamp volume values
-        vol = max(vol, 5000);
-        vol_v = vol_l + ((vol - vol_l) >> 2); // (low-pass) exponential moving average (EMA) approximation
-        vol_l = vol_v;
+        uint16_t volSample;
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { volSample = vol; }
+        #ifdef ISR_BENCHMARK
+            benchmark_volume_used();
+        #endif
+        #ifdef CALIBRATION_DRIFT_TRACKING
+            if (theremin_is_muted()) { calibration_track_volume(volSample); }
+        #endif
+        volSample = max(volSample, 5000);
+        vol_v = filter_update(&volume_filter, volSample); // low-pass filter, see VOLUME_FILTER_MODE
 
         if (audio_is_enabled()) {
-            vol_v = DAC_12BIT_MAX - (volCalibrationBase - vol_v) / 2 + (volumePotValue << 2) - 1024;
+            vol_v = DAC_12BIT_MAX - (volCalibrationBase - vol_v) / 2 + (volumePotValue << 2) - 1024;    // truncates towards 0, >> 1 rounds a negative difference down
         } else {
             vol_v = 0;
         }
@@ -110,19 +118,98 @@ mloop: // Main loop avoiding the GCC "optimization"
         vol_v = min(vol_v, DAC_12BIT_MAX);
         vol_v = max(vol_v, 0);
         clampedVol = vol_v >> 4;
-        // Give vScaledVolume a pseudo-exponential characteristic:
-        vScaledVolume = clampedVol * (clampedVol + 2);
+        // Give vScaledVolume the selected curve characteristic (pseudo-exponential by default):
+        uint16_t scaledVolume = pgm_read_word(&volume_curves[volumeCurveValue][clampedVol]);
+        ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { vScaledVolume = scaledVolume; }
+
+        #ifdef MIDI_OUTPUT
+            midi_set_volume((uint16_t)vol_v);
+        #endif
 
         // if enabled output CV Volume ONLY (GATE output is being used to be measured by the display board)
         #if CV_OUTPUT_MODE == CV_OUTPUT_MODE_LOG || CV_OUTPUT_MODE == CV_OUTPUT_MODE_LINEAR
             // Most synthesizers "exponentiate" the volume CV themselves, thus send the "raw" volume for CV:
-            volCV = vol_v;
-            volumeCVAvailable = true;
+            ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+                volCV = vol_v;
+                volumeCVAvailable = true;
+            }
         #endif
         volumeValueAvailable = false;
     }
-    
-    ui_do_loop();
+}
+
+/*
+ * Task table of the main loop, see scheduler_run(): the period 0 tasks are
+ * polled on every pass, of the periodic tasks at most one runs per pass,
+ * the earliest due one. Periods in timer ticks (32 us).
+ */
+static const scheduler_task_t loop_tasks[] = {
+    #ifdef AUDIO_BLOCK_PIPELINE
+        { ihRenderAudioBlock, 0 },                          // keep the audio ring filled ahead of the ISR
+    #endif
+    { pitch_task, 0 },
+    { volume_task, 0 },
+    { ui_calibration_task, 0 },
+    #if CV_OUTPUT_MODE != CV_OUTPUT_MODE_OFF
+        { cv_task, CV_UPDATE_TICKS },                       // pitch CV: log table lookup and slew limiting
+    #endif
+    { ui_adc_task, 4 },                                     // one conversion (104 us) per run
+    { ui_serial_task, (uint16_t)millisToTicks(1) },         // 1 kHz, one command byte per run
+    { ui_pots_task, (uint16_t)millisToTicks(10) },          // 100 Hz
+    #ifdef MIDI_OUTPUT
+        { midi_task, MIDI_UPDATE_TICKS },                   // note, pitch bend and volume messages
+    #endif
+    #ifdef LINK_STATUS_FRAMES
+        { ui_send_status, (uint16_t)millisToTicks(LINK_STATUS_PERIOD_MS) },
+    #endif
+    { ui_button_action, (uint16_t)millisToTicks(20) },      // 50 Hz, debounces the button as well
+    #ifdef ISR_BENCHMARK
+        { benchmark_loop, 0 },
+    #endif
+};
+static_assert(sizeof(loop_tasks) / sizeof(loop_tasks[0]) <= SCHEDULER_MAX_TASKS, "more tasks than SCHEDULER_MAX_TASKS");
+
+/*
+ * Startup: the audio path only needs the stored calibration (DAC settings and
+ * calibration bases), the interrupts are enabled right after loading it.
+ * The theremin starts muted, so the pots and the UI are set up while the ISR
+ * already runs, the serial output of debug builds comes last.
+ */
+void setup() {
+    Serial.begin(SERIAL_SPEED);
+
+    pinMode(BUTTON_PIN, INPUT_PULLUP);
+    pinMode(LED_BLUE_PIN, OUTPUT);
+    pinMode(LED_RED_PIN, OUTPUT);
+    pinMode(GATE_PIN, OUTPUT);
+    #ifdef MIDI_OUTPUT
+        midi_init();
+    #endif
+    #ifdef PITCH_QUANTIZER
+        quantizer_init();
+    #endif
+
+    settings_load();    // one record read, before the UI and calibration use it
+    calibration_read();
+    ihInitialiseTimer();
+    ihInitialiseInterrupts();
+    #ifdef SERIAL_DEBUG_MESSAGES
+        const unsigned long audio_ready_us = micros();  // since the core started Timer0, before setup()
+    #endif
 
-    goto mloop; // End of main loop
+    ui_initialize();
+    scheduler_init(loop_tasks, sizeof(loop_tasks) / sizeof(loop_tasks[0]));
+
+    DEBUG_PRINTLN("Hello, Theremin world!");
+    #ifdef SERIAL_DEBUG_MESSAGES
+        Serial.print(F("Audio ready after ")); Serial.print(audio_ready_us); Serial.println(F(" us"));
+        printCalibrationDetails();
+    #endif
+}
+
+/**
+ * @brief One main loop iteration: one pass over the task table.
+ */
+void loop() {
+    scheduler_run();
 }
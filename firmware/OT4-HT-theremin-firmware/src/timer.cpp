@@ -1,9 +1,10 @@
 #include "timer.h"
 
-volatile uint16_t timer = 0;
+volatile uint32_t timer = 0;
+uint32_t timerStart = 0;
 
-void ticktimer (uint16_t ticks) {
-  timer = 0;
+void ticktimer (uint32_t ticks) {
+  resetTimer();
   while (timerUnexpired(ticks));
 }
 
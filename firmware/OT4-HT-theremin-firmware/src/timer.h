@@ -1,28 +1,48 @@
 #include <Arduino.h>
+#include <util/atomic.h>
 
 #ifndef _TIMER_H
 #define _TIMER_H
 
-extern volatile uint16_t timer;
+#define TIMER_TICKS_PER_SECOND  31250UL     // one tick per SAMPLE_CLK, 32 us
 
-inline uint16_t millisToTicks(uint16_t milliseconds) {
-  return milliseconds * (1000.0f/32);
+// free-running tick, incremented by ISR(INT1_vect), wraps after ~38 hours
+extern volatile uint32_t timer;
+// readTimer() at the last resetTimer(), start of the timerExpired() interval
+extern uint32_t timerStart;
+
+// timer is incremented by ISR(INT1_vect), 32-bit accesses from the loop must be atomic
+inline uint32_t readTimer() {
+  uint32_t value;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { value = timer; }
+  return value;
+}
+
+// 31.25 = 125 / 4 ticks per millisecond, exact in integers (folded at compile time for constants)
+inline uint32_t millisToTicks(uint32_t milliseconds) {
+  return milliseconds * (TIMER_TICKS_PER_SECOND / 250) / (1000 / 250);
+}
+
+// ticks elapsed since a readTimer() stamp, correct across the wrap
+inline uint32_t ticksSince(uint32_t stamp) {
+  return readTimer() - stamp;
 }
 
+// starts the interval of timerExpired() / timerUnexpired(), the tick itself keeps running
 inline void resetTimer() {
-  timer = 0;
+  timerStart = readTimer();
 }
 
 inline void incrementTimer() {
   timer++;
 }
 
-inline bool timerExpired(uint16_t ticks) {
-  return timer >= ticks;
+inline bool timerExpired(uint32_t ticks) {
+  return ticksSince(timerStart) >= ticks;
 }
 
-inline bool timerUnexpired(uint16_t ticks) {
-  return timer < ticks;
+inline bool timerUnexpired(uint32_t ticks) {
+  return ticksSince(timerStart) < ticks;
 }
 
 inline bool timerExpiredMillis(uint16_t milliseconds) {
@@ -33,7 +53,7 @@ inline bool timerUnexpiredMillis(uint16_t milliseconds) {
   return timerUnexpired(millisToTicks(milliseconds));
 }
 
-void ticktimer (uint16_t ticks);
+void ticktimer (uint32_t ticks);
 void millitimer (uint16_t milliseconds);
 
 #endif // _TIMER_H
@@ -2,8 +2,16 @@
 #include "ihandlers.h"
 #include "timer.h"
 #include "hw.h"
+#include "adc.h"
 #include "../../build_options.h"
 #include "calibration.h"
+#include "volume_curves.h"
+#include "filter.h"
+#include "quantizer.h"
+#include "benchmark.h"
+#include "scheduler.h"
+#include "settings.h"
+#include "../../link_protocol.h"
 
 #define UI_BUTTON_LONG_PRESS_DURATION   60000
 
@@ -19,9 +27,14 @@ bool audio_is_enabled() {
     return _theremin_state == theremin_state_t_playing;
 }
 
+bool theremin_is_muted() {
+    return _theremin_state == theremin_state_t_muted;
+}
+
 typedef enum {
     button_state_t_released,
     button_state_t_long_press_wait,
+    button_state_t_long_press_hold,     // long press reported, waiting for the release
 } button_state_t;
 button_state_t _button_state = button_state_t_released;
 
@@ -36,26 +49,29 @@ int16_t registerPotValue = 0, registerPotValueL = 0;
 int16_t wavePotValue = 0, wavePotValueL = 0;
 uint8_t registerValue = 2; // octave register
 uint8_t registerValueL = 2; // octave register old value
+uint8_t volumeCurveValue = VOLUME_CURVE_DEFAULT; // volume response curve, index into volume_curves[]
 
 /**
  * @brief Read all the potentiometer position and update the changed values
  *        if the hysteresis constant have been surpassed.
+ *
+ * The positions come from the background ADC scan (adc_poll()), this doesn't wait for the ADC.
  * 
  * @param force
  *        optional boolean flag to force the updates (at power-on)
  */
 void ui_potis_read_all(bool force = false) {
-    pitchPotValueL = analogRead(PITCH_POT);
+    pitchPotValueL = adc_value(ADC_POT_PITCH);
     if (force || abs(pitchPotValue - pitchPotValueL) >= pot_rf_virtual_field_adjust_hysteresis) { 
         pitchPotValue = pitchPotValueL;
     }
     
-    volumePotValueL = analogRead(VOLUME_POT);
+    volumePotValueL = adc_value(ADC_POT_VOLUME);
     if (force || abs(volumePotValue - volumePotValueL) >= pot_rf_virtual_field_adjust_hysteresis) { 
         volumePotValue = volumePotValueL;
     }
 
-    registerPotValueL = analogRead(REGISTER_SELECT_POT);
+    registerPotValueL = adc_value(ADC_POT_REGISTER);
     if (force || abs(registerPotValue - registerPotValueL) >= pot_register_selection_hysteresis) { 
         registerPotValue = registerPotValueL;
         // register pot offset configuration:
@@ -71,11 +87,15 @@ void ui_potis_read_all(bool force = false) {
             DEBUG_PRINTLN(F("OCT+0"));
         }
         if (registerValueL != registerValue) {
-        registerValue = registerValueL;
-    }
+            registerValue = registerValueL;
+            if (!force) {
+                // register 1..3 = OCT+1, OCT+0, OCT-1
+                Serial.write(STATE_CMD_REGISTER_HIGH + 1 - registerValue);
+            }
+        }
     }
 
-    wavePotValueL = analogRead(WAVE_SELECT_POT);
+    wavePotValueL = adc_value(ADC_POT_WAVE);
     if (force || abs(wavePotValue - wavePotValueL) >= pot_waveform_selection_hysteresis) {
         wavePotValue = wavePotValueL;
         // map 0–1023 to 0–(num_wavetables - 1)
@@ -83,14 +103,56 @@ void ui_potis_read_all(bool force = false) {
         if (scaled >= num_wavetables) scaled = num_wavetables - 1;    // extra safety
         if (scaled != vWavetableSelector) {
             vWavetableSelector = scaled;
+            setWavetableSampleAdvance(vPointerIncrement);   // refresh the wavetable level for the new timbre
+            if (!force) {
+                Serial.write(STATE_CMD_WAVEFORM_BASE + scaled);
+            }
             DEBUG_PRINT(F("WAV="));DEBUG_PRINTLN(scaled);
         }
     }
 }
 
+/**
+ * @brief Answers a STATE_CMD_DIAGNOSTICS query with the runtime counters
+ *        of the enabled build options, as plain text.
+ */
+void ui_print_diagnostics() {
+    uint16_t pitchRaw, pitchAveraged;
+    noInterrupts();
+    pitchRaw = pitch_raw;
+    pitchAveraged = pitch;
+    interrupts();
+    Serial.print(F("PITCH_RAW=")); Serial.print(pitchRaw);
+    Serial.print(F(" PITCH=")); Serial.print(pitchAveraged);
+    Serial.print(F(" WINDOW=")); Serial.println(PITCH_MEASUREMENT_WINDOW);
+    Serial.print(F("FILTER P=")); Serial.print(pitch_filter.mode); Serial.print('/'); Serial.print(pitch_filter.shift);
+    Serial.print(F(" V=")); Serial.print(volume_filter.mode); Serial.print('/'); Serial.println(volume_filter.shift);
+    Serial.print(F("BASE P=")); Serial.print(pitchCalibrationBase);
+    Serial.print(F(" V=")); Serial.println(volCalibrationBase);
+
+    #ifdef AUDIO_BLOCK_PIPELINE
+        uint16_t underruns;
+        noInterrupts();
+        underruns = audioUnderruns;
+        interrupts();
+        Serial.print(F("UNDERRUNS=")); Serial.println(underruns);
+    #endif
+
+    #ifdef ISR_BENCHMARK
+        benchmark_print();
+        scheduler_print();
+    #endif
+}
+
 void ui_initialize() {
     HW_LED_RED_ON; // muted state at power-cycle.
+    adc_initialize();
     ui_potis_read_all(true);
+
+    volumeCurveValue = settings.data.volumeCurve;
+    if (volumeCurveValue >= VOLUME_CURVES_COUNT) {
+        volumeCurveValue = VOLUME_CURVE_DEFAULT;   // blank or invalid EEPROM
+    }
 }
 
 void ui_button_action() {
@@ -107,20 +169,96 @@ void ui_button_action() {
                 _button_state = button_state_t_released;
                 Serial.write(STATE_CMD_BUTTON_SHORT_PRESS);
             } else if (timerExpired(UI_BUTTON_LONG_PRESS_DURATION)) {
-                _button_state = button_state_t_released;
+                _button_state = button_state_t_long_press_hold;
                 Serial.write(STATE_CMD_BUTTON_LONG_PRESS);
-                while (HW_BUTTON_PRESSED) {}
             }
         break;
+
+        case button_state_t_long_press_hold:
+            if (HW_BUTTON_RELEASED) { _button_state = button_state_t_released; }
+        break;
+    }
+}
+
+/**
+ * @brief Advances the running calibration, called instead of the normal UI loop.
+ *
+ * Only STATE_CMD_CALIBRATION_CANCEL is served from the UART meanwhile,
+ * the button still reports short presses (the display cancels with them).
+ */
+void ui_calibration_loop() {
+    if (Serial.available() && Serial.read() == STATE_CMD_CALIBRATION_CANCEL) {
+        calibration_cancel();
+        HW_LED_BLUE_OFF; HW_LED_RED_ON;
+        _theremin_state = theremin_state_t_muted;
+        Serial.write(STATE_CMD_CALIBRATION_CANCEL);
+        return;
+    }
+
+    calibration_result_t result = calibration_step();
+    if (result == calibration_result_t_success) {
+        HW_LED_BLUE_ON; HW_LED_RED_OFF;
+        _theremin_state = theremin_state_t_playing;
+
+        #if AUDIO_FEEDBACK_MODE == AUDIO_FEEDBACK_ON
+            playTone(MIDDLE_C * 2, 150, 25);
+            playTone(MIDDLE_C * 2, 150, 25);
+        #endif
+    } else if (result == calibration_result_t_error) {
+        HW_LED_BLUE_OFF;
+        for (int i = 0; i<10; i++) {
+            millitimer(200 - (i * 10));
+            HW_LED_RED_TOGGLE;
+        }
+        #if AUDIO_FEEDBACK_MODE == AUDIO_FEEDBACK_ON
+            playTone(MIDDLE_C * 4, 150, 25);
+            playTone(MIDDLE_C, 150, 25);
+        #endif
+        HW_LED_RED_ON;
+        _theremin_state = theremin_state_t_muted;
+    }
+}
+
+#ifdef LINK_STATUS_FRAMES
+/**
+ * @brief Streams the pitch, register and volume to the display, scheduled every LINK_STATUS_PERIOD_MS.
+ */
+void ui_send_status() {
+    if (_theremin_state == theremin_state_t_calibrating) { return; }
+
+    uint16_t increment = vPointerIncrement;     // only written by the main loop
+    uint8_t payload[LINK_FRAME_STATUS_LENGTH];
+    payload[0] = increment & 0xff;
+    payload[1] = increment >> 8;
+    payload[2] = registerValue;
+    payload[3] = audio_is_enabled() ? (vScaledVolume >> 8) : 0;
+    link_send_frame(LINK_FRAME_STATUS, payload, sizeof(payload));
+}
+#endif
+
+/**
+ * @brief Runs the calibration while one is in progress, polled on every scheduler pass.
+ */
+void ui_calibration_task() {
+    if (_theremin_state == theremin_state_t_calibrating) {
+        ui_calibration_loop();
     }
 }
 
-void ui_do_loop() {
+/**
+ * @brief Serves one command byte from the display board.
+ *
+ * During a calibration ui_calibration_loop() reads the UART instead.
+ */
+void ui_serial_task() {
+    if (_theremin_state == theremin_state_t_calibrating) { return; }
+
     if (Serial.available()) {
         uint8_t b = Serial.read();
         switch (b) {
-            case STATE_CMD_CALIBRATION: {
-                Serial.write(STATE_CMD_CALIBRATION);
+            case STATE_CMD_CALIBRATION:
+            case STATE_CMD_CALIBRATION_QUICK: {
+                Serial.write(b);
                 HW_LED_BLUE_ON; HW_LED_RED_ON;
                 
                 #if AUDIO_FEEDBACK_MODE == AUDIO_FEEDBACK_ON
@@ -129,41 +267,18 @@ void ui_do_loop() {
                     playTone(MIDDLE_C * 4, 150, 25);
                 #endif
 
-                // signal the player to move the hands away from antennas.
-                for (int i = 0; i<10; i++) {
-                    millitimer(200 - (i * 10));
-                    HW_LED_BLUE_TOGGLE; HW_LED_RED_TOGGLE;
-                }
-                // pink color for calibration
-                HW_LED_BLUE_ON; HW_LED_RED_ON;
+                // the LED countdown (move the hands away from antennas) and the
+                // calibration itself run from ui_calibration_loop()
                 _theremin_state = theremin_state_t_calibrating;
-
-                bool success = calibration_start();
-                if (success) {
-                    HW_LED_BLUE_ON; HW_LED_RED_OFF;
-                    _theremin_state = theremin_state_t_playing;
-
-                    #if AUDIO_FEEDBACK_MODE == AUDIO_FEEDBACK_ON
-                        playTone(MIDDLE_C * 2, 150, 25);
-                        playTone(MIDDLE_C * 2, 150, 25);
-                    #endif
-                } else {
-                    HW_LED_BLUE_OFF;
-                    for (int i = 0; i<10; i++) {
-                        millitimer(200 - (i * 10));
-                        HW_LED_RED_TOGGLE;
-                    }
-                    #if AUDIO_FEEDBACK_MODE == AUDIO_FEEDBACK_ON
-                        playTone(MIDDLE_C * 4, 150, 25);
-                        playTone(MIDDLE_C, 150, 25);
-                    #endif
-                    HW_LED_RED_ON;
-                }
+                calibration_begin(b == STATE_CMD_CALIBRATION_QUICK);
             } break;
 
             case STATE_CMD_MUTE:
                 HW_LED_BLUE_OFF; HW_LED_RED_ON;
                 _theremin_state = theremin_state_t_muted;
+                #ifdef CALIBRATION_DRIFT_TRACKING
+                    calibration_track_reset();  // the average restarts with the hands away
+                #endif
                 Serial.write(STATE_CMD_MUTE);
                 break;
 
@@ -173,12 +288,51 @@ void ui_do_loop() {
                 Serial.write(STATE_CMD_UNMUTE);
                 break;
 
+            case STATE_CMD_DIAGNOSTICS:
+                ui_print_diagnostics();
+                break;
+
             default:
+                if (b >= STATE_CMD_VOLUME_CURVE_BASE && b < STATE_CMD_VOLUME_CURVE_BASE + VOLUME_CURVES_COUNT) {
+                    volumeCurveValue = b - STATE_CMD_VOLUME_CURVE_BASE;
+                    settings.data.volumeCurve = volumeCurveValue;
+                    settings.save();
+                    Serial.write(b);
+                } else if (b >= STATE_CMD_PITCH_FILTER_BASE && b <= STATE_CMD_PITCH_FILTER_BASE + FILTER_MODE_ADAPTIVE) {
+                    filter_set_mode(&pitch_filter, b - STATE_CMD_PITCH_FILTER_BASE);
+                } else if (b >= STATE_CMD_VOLUME_FILTER_BASE && b <= STATE_CMD_VOLUME_FILTER_BASE + FILTER_MODE_ADAPTIVE) {
+                    filter_set_mode(&volume_filter, b - STATE_CMD_VOLUME_FILTER_BASE);
+                } else if (b > STATE_CMD_PITCH_FILTER_SHIFT_BASE && b <= STATE_CMD_PITCH_FILTER_SHIFT_BASE + FILTER_MAX_SHIFT) {
+                    filter_set_shift(&pitch_filter, b - STATE_CMD_PITCH_FILTER_SHIFT_BASE);
+                } else if (b > STATE_CMD_VOLUME_FILTER_SHIFT_BASE && b <= STATE_CMD_VOLUME_FILTER_SHIFT_BASE + FILTER_MAX_SHIFT) {
+                    filter_set_shift(&volume_filter, b - STATE_CMD_VOLUME_FILTER_SHIFT_BASE);
+                #ifdef PITCH_QUANTIZER
+                } else if (b >= STATE_CMD_QUANTIZER_STRENGTH_BASE && b <= STATE_CMD_QUANTIZER_STRENGTH_BASE + QUANTIZER_STRENGTH_MAX) {
+                    quantizer_set_strength(b - STATE_CMD_QUANTIZER_STRENGTH_BASE);
+                } else if (b >= STATE_CMD_QUANTIZER_GLIDE_BASE && b <= STATE_CMD_QUANTIZER_GLIDE_BASE + QUANTIZER_GLIDE_MAX) {
+                    quantizer_set_glide(b - STATE_CMD_QUANTIZER_GLIDE_BASE);
+                } else if (b >= STATE_CMD_CONCERT_A_BASE && b < STATE_CMD_CONCERT_A_BASE + STATE_CMD_CONCERT_A_COUNT) {
+                    quantizer_set_concert_a(STATE_CMD_CONCERT_A_MIN + (b - STATE_CMD_CONCERT_A_BASE));
+                #endif
+                }
                 //DEBUG_PRINT(b); // echo
                 break;
         }
     }
-    ui_button_action();
+}
+
+/**
+ * @brief Advances the background ADC scan by at most one conversion.
+ */
+void ui_adc_task() {
+    adc_poll();
+}
+
+/**
+ * @brief Applies the latest pot readings (offsets, register, waveform).
+ */
+void ui_pots_task() {
+    if (_theremin_state == theremin_state_t_calibrating) { return; }
     ui_potis_read_all();
 }
 
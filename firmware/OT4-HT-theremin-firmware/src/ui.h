@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include "../../build_options.h"
 
 #ifndef _DISPLAY_INTERFACE_H_
 #define _DISPLAY_INTERFACE_H_
@@ -6,10 +7,21 @@
 extern int16_t pitchPotValue;
 extern int16_t volumePotValue;
 extern uint8_t registerValue;
+extern uint8_t volumeCurveValue;
 
 void ui_initialize();
-void ui_do_loop();
+
+// scheduler tasks, see the task table in theremin_main.cpp
+void ui_calibration_task();
+void ui_serial_task();
+void ui_button_action();
+void ui_adc_task();
+void ui_pots_task();
+#ifdef LINK_STATUS_FRAMES
+void ui_send_status();
+#endif
 
 bool audio_is_enabled();
+bool theremin_is_muted();
 
 #endif // _DISPLAY_INTERFACE_H_
\ No newline at end of file
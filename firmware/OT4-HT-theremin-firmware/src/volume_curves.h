@@ -0,0 +1,151 @@
+/* Theremin volume curves - generated by scripts/gen_volume_curves.py, do not edit.
+ * index: clamped 8-bit volume, value: vScaledVolume (0..65535)
+ */
+
+#ifndef VOLUME_CURVES_H
+#define VOLUME_CURVES_H
+
+#include <avr/pgmspace.h>
+
+#define VOLUME_CURVES_COUNT 4
+
+const uint16_t volume_curves[VOLUME_CURVES_COUNT][256] PROGMEM = {
+    { // pseudo-exponential c * (c + 2)
+            0,     3,     8,    15,    24,    35,    48,    63,
+           80,    99,   120,   143,   168,   195,   224,   255,
+          288,   323,   360,   399,   440,   483,   528,   575,
+          624,   675,   728,   783,   840,   899,   960,  1023,
+         1088,  1155,  1224,  1295,  1368,  1443,  1520,  1599,
+         1680,  1763,  1848,  1935,  2024,  2115,  2208,  2303,
+         2400,  2499,  2600,  2703,  2808,  2915,  3024,  3135,
+         3248,  3363,  3480,  3599,  3720,  3843,  3968,  4095,
+         4224,  4355,  4488,  4623,  4760,  4899,  5040,  5183,
+         5328,  5475,  5624,  5775,  5928,  6083,  6240,  6399,
+         6560,  6723,  6888,  7055,  7224,  7395,  7568,  7743,
+         7920,  8099,  8280,  8463,  8648,  8835,  9024,  9215,
+         9408,  9603,  9800,  9999, 10200, 10403, 10608, 10815,
+        11024, 11235, 11448, 11663, 11880, 12099, 12320, 12543,
+        12768, 12995, 13224, 13455, 13688, 13923, 14160, 14399,
+        14640, 14883, 15128, 15375, 15624, 15875, 16128, 16383,
+        16640, 16899, 17160, 17423, 17688, 17955, 18224, 18495,
+        18768, 19043, 19320, 19599, 19880, 20163, 20448, 20735,
+        21024, 21315, 21608, 21903, 22200, 22499, 22800, 23103,
+        23408, 23715, 24024, 24335, 24648, 24963, 25280, 25599,
+        25920, 26243, 26568, 26895, 27224, 27555, 27888, 28223,
+        28560, 28899, 29240, 29583, 29928, 30275, 30624, 30975,
+        31328, 31683, 32040, 32399, 32760, 33123, 33488, 33855,
+        34224, 34595, 34968, 35343, 35720, 36099, 36480, 36863,
+        37248, 37635, 38024, 38415, 38808, 39203, 39600, 39999,
+        40400, 40803, 41208, 41615, 42024, 42435, 42848, 43263,
+        43680, 44099, 44520, 44943, 45368, 45795, 46224, 46655,
+        47088, 47523, 47960, 48399, 48840, 49283, 49728, 50175,
+        50624, 51075, 51528, 51983, 52440, 52899, 53360, 53823,
+        54288, 54755, 55224, 55695, 56168, 56643, 57120, 57599,
+        58080, 58563, 59048, 59535, 60024, 60515, 61008, 61503,
+        62000, 62499, 63000, 63503, 64008, 64515, 65024, 65535,
+    },
+    { // exponential, 48 dB range
+            0,   267,   272,   278,   285,   291,   297,   304,
+          310,   317,   324,   331,   338,   346,   353,   361,
+          369,   377,   385,   394,   402,   411,   420,   429,
+          439,   449,   458,   468,   479,   489,   500,   511,
+          522,   533,   545,   557,   569,   582,   594,   607,
+          621,   634,   648,   662,   677,   692,   707,   722,
+          738,   754,   771,   788,   805,   823,   841,   859,
+          878,   897,   917,   937,   958,   979,  1000,  1022,
+         1044,  1067,  1091,  1114,  1139,  1164,  1189,  1215,
+         1242,  1269,  1297,  1325,  1354,  1384,  1414,  1445,
+         1477,  1509,  1543,  1576,  1611,  1646,  1682,  1719,
+         1757,  1795,  1835,  1875,  1916,  1958,  2001,  2045,
+         2089,  2135,  2182,  2230,  2279,  2328,  2379,  2432,
+         2485,  2539,  2595,  2652,  2710,  2769,  2830,  2892,
+         2955,  3020,  3086,  3154,  3223,  3293,  3366,  3439,
+         3515,  3592,  3670,  3751,  3833,  3917,  4003,  4090,
+         4180,  4272,  4365,  4461,  4559,  4658,  4760,  4865,
+         4971,  5080,  5192,  5305,  5422,  5540,  5662,  5786,
+         5912,  6042,  6174,  6310,  6448,  6589,  6733,  6881,
+         7032,  7186,  7343,  7504,  7668,  7836,  8008,  8184,
+         8363,  8546,  8733,  8925,  9120,  9320,  9524,  9733,
+         9946, 10164, 10387, 10614, 10847, 11084, 11327, 11575,
+        11829, 12088, 12353, 12623, 12900, 13183, 13471, 13767,
+        14068, 14376, 14691, 15013, 15342, 15678, 16022, 16373,
+        16731, 17098, 17473, 17855, 18246, 18646, 19055, 19472,
+        19899, 20335, 20780, 21235, 21701, 22176, 22662, 23158,
+        23666, 24184, 24714, 25255, 25809, 26374, 26952, 27542,
+        28146, 28762, 29393, 30037, 30695, 31367, 32054, 32756,
+        33474, 34207, 34957, 35723, 36505, 37305, 38122, 38957,
+        39811, 40683, 41574, 42485, 43416, 44367, 45339, 46332,
+        47347, 48385, 49445, 50528, 51635, 52766, 53922, 55104,
+        56311, 57544, 58805, 60093, 61410, 62755, 64130, 65535,
+    },
+    { // linear c * 257
+            0,   257,   514,   771,  1028,  1285,  1542,  1799,
+         2056,  2313,  2570,  2827,  3084,  3341,  3598,  3855,
+         4112,  4369,  4626,  4883,  5140,  5397,  5654,  5911,
+         6168,  6425,  6682,  6939,  7196,  7453,  7710,  7967,
+         8224,  8481,  8738,  8995,  9252,  9509,  9766, 10023,
+        10280, 10537, 10794, 11051, 11308, 11565, 11822, 12079,
+        12336, 12593, 12850, 13107, 13364, 13621, 13878, 14135,
+        14392, 14649, 14906, 15163, 15420, 15677, 15934, 16191,
+        16448, 16705, 16962, 17219, 17476, 17733, 17990, 18247,
+        18504, 18761, 19018, 19275, 19532, 19789, 20046, 20303,
+        20560, 20817, 21074, 21331, 21588, 21845, 22102, 22359,
+        22616, 22873, 23130, 23387, 23644, 23901, 24158, 24415,
+        24672, 24929, 25186, 25443, 25700, 25957, 26214, 26471,
+        26728, 26985, 27242, 27499, 27756, 28013, 28270, 28527,
+        28784, 29041, 29298, 29555, 29812, 30069, 30326, 30583,
+        30840, 31097, 31354, 31611, 31868, 32125, 32382, 32639,
+        32896, 33153, 33410, 33667, 33924, 34181, 34438, 34695,
+        34952, 35209, 35466, 35723, 35980, 36237, 36494, 36751,
+        37008, 37265, 37522, 37779, 38036, 38293, 38550, 38807,
+        39064, 39321, 39578, 39835, 40092, 40349, 40606, 40863,
+        41120, 41377, 41634, 41891, 42148, 42405, 42662, 42919,
+        43176, 43433, 43690, 43947, 44204, 44461, 44718, 44975,
+        45232, 45489, 45746, 46003, 46260, 46517, 46774, 47031,
+        47288, 47545, 47802, 48059, 48316, 48573, 48830, 49087,
+        49344, 49601, 49858, 50115, 50372, 50629, 50886, 51143,
+        51400, 51657, 51914, 52171, 52428, 52685, 52942, 53199,
+        53456, 53713, 53970, 54227, 54484, 54741, 54998, 55255,
+        55512, 55769, 56026, 56283, 56540, 56797, 57054, 57311,
+        57568, 57825, 58082, 58339, 58596, 58853, 59110, 59367,
+        59624, 59881, 60138, 60395, 60652, 60909, 61166, 61423,
+        61680, 61937, 62194, 62451, 62708, 62965, 63222, 63479,
+        63736, 63993, 64250, 64507, 64764, 65021, 65278, 65535,
+    },
+    { // custom user curve
+            0,    19,    38,    56,    75,    94,   112,   131,
+          150,   169,   188,   206,   225,   244,   262,   281,
+          300,   319,   338,   356,   375,   394,   412,   431,
+          450,   469,   488,   506,   525,   544,   562,   581,
+          600,   716,   831,   947,  1062,  1178,  1294,  1409,
+         1525,  1641,  1756,  1872,  1988,  2103,  2219,  2334,
+         2450,  2566,  2681,  2797,  2912,  3028,  3144,  3259,
+         3375,  3491,  3606,  3722,  3838,  3953,  4069,  4184,
+         4300,  4416,  4531,  4647,  4762,  4878,  4994,  5109,
+         5225,  5341,  5456,  5572,  5688,  5803,  5919,  6034,
+         6150,  6266,  6381,  6497,  6612,  6728,  6844,  6959,
+         7075,  7191,  7306,  7422,  7538,  7653,  7769,  7884,
+         8000,  8344,  8688,  9031,  9375,  9719, 10062, 10406,
+        10750, 11094, 11438, 11781, 12125, 12469, 12812, 13156,
+        13500, 13844, 14188, 14531, 14875, 15219, 15562, 15906,
+        16250, 16594, 16938, 17281, 17625, 17969, 18312, 18656,
+        19000, 19344, 19688, 20031, 20375, 20719, 21062, 21406,
+        21750, 22094, 22438, 22781, 23125, 23469, 23812, 24156,
+        24500, 24844, 25188, 25531, 25875, 26219, 26562, 26906,
+        27250, 27594, 27938, 28281, 28625, 28969, 29312, 29656,
+        30000, 30438, 30875, 31312, 31750, 32188, 32625, 33062,
+        33500, 33938, 34375, 34812, 35250, 35688, 36125, 36562,
+        37000, 37438, 37875, 38312, 38750, 39188, 39625, 40062,
+        40500, 40938, 41375, 41812, 42250, 42688, 43125, 43562,
+        44000, 44438, 44875, 45312, 45750, 46188, 46625, 47062,
+        47500, 47938, 48375, 48812, 49250, 49688, 50125, 50562,
+        51000, 51438, 51875, 52312, 52750, 53188, 53625, 54062,
+        54500, 54938, 55375, 55812, 56250, 56688, 57125, 57562,
+        58000, 58243, 58486, 58729, 58972, 59215, 59458, 59701,
+        59945, 60188, 60431, 60674, 60917, 61160, 61403, 61646,
+        61889, 62132, 62375, 62618, 62861, 63104, 63347, 63590,
+        63834, 64077, 64320, 64563, 64806, 65049, 65292, 65535,
+    },
+};
+
+#endif // VOLUME_CURVES_H
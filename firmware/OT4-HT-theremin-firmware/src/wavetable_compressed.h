@@ -0,0 +1,1680 @@
+/* Theremin WAVE Tables, compressed - generated by scripts/gen_wavetable_compressed.py, do not edit.
+ *
+ * FLASH BUDGET (ATmega328P, 32256 bytes available to the sketch)
+ *   wavetable_0            BLOCK8     1280 bytes
+ *   wavetable_1            BLOCK8     1280 bytes
+ *   wavetable_2            PACKED12   1537 bytes
+ *   wavetable_3            BLOCK8     1280 bytes
+ *   wavetable_4            PACKED12   1537 bytes
+ *   wavetable_5            BLOCK8     1280 bytes
+ *   wavetable_6            PACKED12   1537 bytes
+ *   wavetable_7            BLOCK8     1280 bytes
+ *   wavetable_sine1024     QUARTER     514 bytes
+ *   wavetable_triangle     QUARTER     514 bytes
+ *   wavetable_square       QUARTER     514 bytes
+ *   wavetable_clarinet     QUARTER     514 bytes
+ *   wavetable_hollow       QUARTER     514 bytes
+ *   wavetable_flute        QUARTER     514 bytes
+ *   wavetable_oboe         QUARTER     514 bytes
+ *   wavetable_bell         QUARTER     514 bytes
+ *   descriptors            RAM          80 bytes
+ *   16 timbres                       15123 bytes, the 8 full tables alone take 16384
+ */
+
+#ifndef WAVETABLE_COMPRESSED_H
+#define WAVETABLE_COMPRESSED_H
+
+#include <avr/pgmspace.h>
+
+#define WAVETABLE_FORMAT_QUARTER   0
+#define WAVETABLE_FORMAT_HALF      1
+#define WAVETABLE_FORMAT_BLOCK8    2
+#define WAVETABLE_FORMAT_PACKED12  3
+
+typedef struct {
+    uint8_t format;         // WAVETABLE_FORMAT_xxx
+    const void *data;       // samples, block bases or packed bytes in PROGMEM
+    const int8_t *offsets;  // WAVETABLE_FORMAT_BLOCK8 offsets in PROGMEM, NULL otherwise
+} wavetable_compressed_t;
+
+const int16_t wavetable_0_base[128] PROGMEM = {
+       50,   166,   280,   395,   506,   616,   723,   828,
+      929,  1028,  1122,  1213,  1300,  1382,  1460,  1533,
+     1601,  1665,  1725,  1778,  1827,  1870,  1909,  1943,
+     1971,  1995,  2015,  2029,  2039,  2045,  2046,  2043,
+     2036,  2025,  2011,  1992,  1970,  1946,  1917,  1886,
+     1852,  1816,  1776,  1734,  1690,  1643,  1595,  1543,
+     1490,  1436,  1378,  1319,  1258,  1196,  1131,  1065,
+      997,   928,   856,   783,   708,   633,   554,   475,
+      395,   312,   229,   145,    59,   -28,  -115,  -203,
+     -292,  -382,  -471,  -560,  -650,  -739,  -827,  -914,
+    -1000, -1085, -1169, -1250, -1329, -1405, -1478, -1548,
+    -1615, -1677, -1737, -1791, -1841, -1885, -1926, -1960,
+    -1989, -2011, -2029, -2039, -2044, -2043, -2034, -2019,
+    -1998, -1970, -1935, -1895, -1848, -1795, -1736, -1670,
+    -1600, -1524, -1442, -1355, -1265, -1169, -1070,  -968,
+     -862,  -753,  -643,  -530,  -415,  -300,  -183,   -67,
+};
+const int8_t wavetable_0_ofs[1024] PROGMEM = {
+     -51,  -37,  -22,   -8,    7,   21,   36,   50,
+     -51,  -37,  -22,   -7,    7,   22,   35,   50,
+     -50,  -35,  -21,   -7,    8,   22,   37,   50,
+     -50,  -37,  -22,   -8,    6,   21,   34,   49,
+     -49,  -34,  -21,   -6,    7,   21,   34,   49,
+     -48,  -35,  -20,   -7,    7,   20,   34,   47,
+     -47,  -33,  -20,   -7,    7,   20,   33,   47,
+     -45,  -32,  -20,   -7,    7,   20,   32,   45,
+     -44,  -31,  -18,   -6,    7,   19,   31,   44,
+     -43,  -30,  -18,   -6,    5,   18,   30,   42,
+     -41,  -29,  -17,   -6,    6,   18,   29,   41,
+     -39,  -28,  -16,   -6,    6,   17,   28,   38,
+     -37,  -27,  -16,   -5,    5,   16,   26,   36,
+     -35,  -25,  -14,   -5,    5,   15,   25,   35,
+     -33,  -24,  -14,   -5,    5,   14,   23,   33,
+     -31,  -22,  -13,   -5,    4,   13,   22,   30,
+     -29,  -20,  -12,   -3,    5,   13,   22,   29,
+     -26,  -19,  -11,   -3,    4,   12,   19,   26,
+     -25,  -18,  -11,   -5,    2,   10,   17,   24,
+     -23,  -16,  -10,   -3,    3,    9,   16,   22,
+     -21,  -15,   -9,   -4,    2,    8,   14,   20,
+     -19,  -13,   -7,   -2,    3,    8,   13,   18,
+     -16,  -11,   -7,   -2,    2,    7,   12,   15,
+     -14,  -10,   -6,   -2,    2,    6,   10,   13,
+     -12,   -8,   -5,   -1,    2,    6,    9,   11,
+      -9,   -6,   -3,   -1,    2,    5,    7,    9,
+      -8,   -6,   -4,   -1,    1,    3,    5,    7,
+      -6,   -3,   -2,   -1,    2,    3,    4,    6,
+      -3,   -3,   -1,    0,    0,    2,    2,    3,
+      -2,   -2,    0,    0,    0,    1,    0,    1,
+       0,    1,    0,    0,    0,    0,    0,   -1,
+       2,    2,    1,    1,    0,   -1,   -2,   -2,
+       4,    3,    2,    1,   -1,   -2,   -3,   -5,
+       5,    4,    3,    1,   -1,   -2,   -4,   -6,
+       7,    5,    3,    1,   -1,   -3,   -5,   -8,
+       9,    7,    4,    2,   -1,   -4,   -6,   -9,
+      10,    7,    5,    2,   -1,   -3,   -7,  -10,
+      11,    7,    5,    1,   -2,   -5,   -9,  -12,
+      13,    9,    6,    3,   -2,   -5,   -9,  -13,
+      14,   11,    7,    3,   -1,   -6,  -10,  -14,
+      15,   11,    7,    3,   -2,   -7,  -11,  -15,
+      16,   12,    7,    2,   -3,   -7,  -13,  -17,
+      17,   13,    8,    3,   -3,   -8,  -13,  -18,
+      19,   13,    8,    2,   -3,   -8,  -13,  -19,
+      20,   14,    8,    2,   -3,   -9,  -15,  -20,
+      21,   15,    9,    3,   -3,   -9,  -15,  -21,
+      21,   15,    9,    2,   -4,  -10,  -16,  -22,
+      23,   16,   10,    3,   -3,  -10,  -16,  -23,
+      24,   17,   10,    3,   -4,  -10,  -17,  -24,
+      24,   16,    9,    3,   -5,  -11,  -19,  -25,
+      25,   18,   11,    3,   -3,  -11,  -18,  -26,
+      26,   18,   11,    4,   -4,  -11,  -18,  -26,
+      27,   19,   11,    4,   -4,  -12,  -19,  -27,
+      27,   19,   11,    3,   -5,  -13,  -20,  -28,
+      28,   20,   12,    4,   -4,  -13,  -20,  -29,
+      29,   21,   12,    4,   -4,  -13,  -21,  -30,
+      30,   21,   13,    4,   -4,  -13,  -21,  -31,
+      30,   21,   13,    3,   -5,  -14,  -23,  -31,
+      31,   23,   13,    4,   -4,  -14,  -23,  -32,
+      32,   23,   13,    5,   -5,  -14,  -23,  -33,
+      33,   24,   14,    5,   -5,  -14,  -23,  -33,
+      33,   23,   14,    4,   -6,  -15,  -25,  -34,
+      34,   25,   15,    5,   -5,  -14,  -25,  -34,
+      35,   25,   15,    5,   -5,  -15,  -25,  -35,
+      35,   25,   15,    5,   -6,  -15,  -26,  -36,
+      36,   27,   16,    5,   -5,  -15,  -25,  -36,
+      37,   26,   16,    5,   -5,  -16,  -26,  -37,
+      37,   26,   15,    5,   -6,  -17,  -27,  -38,
+      38,   26,   16,    5,   -5,  -17,  -27,  -38,
+      38,   28,   17,    6,   -5,  -16,  -27,  -38,
+      38,   27,   16,    6,   -6,  -17,  -28,  -39,
+      38,   27,   16,    5,   -6,  -17,  -28,  -39,
+      39,   28,   17,    5,   -6,  -17,  -28,  -39,
+      39,   28,   17,    6,   -5,  -16,  -28,  -39,
+      39,   28,   16,    6,   -6,  -17,  -28,  -40,
+      39,   28,   16,    5,   -7,  -18,  -28,  -39,
+      39,   28,   17,    6,   -6,  -17,  -28,  -39,
+      39,   28,   16,    6,   -5,  -17,  -28,  -39,
+      38,   28,   16,    5,   -6,  -17,  -27,  -39,
+      37,   27,   16,    5,   -6,  -17,  -27,  -38,
+      37,   26,   15,    4,   -6,  -17,  -28,  -38,
+      36,   25,   15,    4,   -6,  -16,  -27,  -37,
+      36,   25,   15,    6,   -5,  -15,  -26,  -36,
+      35,   25,   15,    5,   -5,  -15,  -25,  -35,
+      34,   25,   15,    5,   -5,  -14,  -24,  -34,
+      33,   23,   13,    5,   -5,  -14,  -23,  -33,
+      31,   22,   13,    4,   -5,  -14,  -23,  -31,
+      30,   20,   12,    3,   -5,  -14,  -22,  -30,
+      28,   20,   12,    4,   -4,  -13,  -21,  -28,
+      26,   17,   10,    3,   -6,  -13,  -20,  -27,
+      25,   18,   11,    3,   -4,  -11,  -18,  -25,
+      23,   15,    9,    3,   -5,  -11,  -17,  -24,
+      20,   15,    8,    2,   -3,   -9,  -15,  -21,
+      18,   12,    6,    1,   -5,  -10,  -14,  -19,
+      16,   11,    7,    2,   -3,   -7,  -12,  -16,
+      14,    9,    5,    1,   -3,   -6,  -10,  -15,
+      11,    7,    4,    1,   -2,   -5,   -8,  -11,
+       8,    5,    2,   -1,   -3,   -6,   -8,   -9,
+       6,    4,    2,    0,   -1,   -3,   -5,   -6,
+       3,    1,    0,   -1,   -2,   -3,   -3,   -4,
+       1,    0,    0,   -1,   -1,   -2,   -1,   -1,
+      -2,   -1,   -1,   -1,    0,    1,    2,    2,
+      -6,   -4,   -3,   -2,    0,    1,    3,    5,
+      -8,   -7,   -5,   -3,   -1,    3,    5,    7,
+     -11,   -8,   -5,   -3,    1,    4,    7,   10,
+     -14,  -11,   -7,   -3,    1,    4,    9,   13,
+     -17,  -14,   -9,   -4,    1,    6,   11,   16,
+     -19,  -14,   -9,   -3,    2,    7,   13,   19,
+     -23,  -16,  -10,   -4,    2,    9,   15,   22,
+     -25,  -19,  -11,   -5,    3,   10,   17,   25,
+     -28,  -20,  -12,   -4,    3,   11,   19,   27,
+     -30,  -22,  -14,   -5,    3,   12,   21,   29,
+     -32,  -23,  -14,   -5,    5,   14,   23,   32,
+     -34,  -24,  -15,   -5,    5,   15,   25,   34,
+     -37,  -26,  -16,   -5,    4,   15,   25,   37,
+     -39,  -28,  -18,   -7,    5,   15,   26,   38,
+     -41,  -29,  -17,   -7,    5,   17,   29,   41,
+     -43,  -31,  -19,   -7,    5,   17,   29,   42,
+     -44,  -32,  -20,   -7,    5,   18,   31,   44,
+     -46,  -33,  -20,   -6,    6,   19,   32,   46,
+     -47,  -34,  -20,   -7,    6,   19,   33,   47,
+     -48,  -35,  -22,   -7,    6,   20,   34,   47,
+     -49,  -35,  -21,   -6,    7,   21,   36,   49,
+     -50,  -35,  -21,   -7,    7,   21,   36,   50,
+     -50,  -36,  -22,   -7,    7,   21,   36,   50,
+     -51,  -36,  -22,   -7,    8,   22,   36,   50,
+     -51,  -37,  -23,   -7,    7,   21,   36,   50,
+     -51,  -36,  -22,   -7,    7,   23,   37,   51,
+};
+
+const int16_t wavetable_1_base[128] PROGMEM = {
+        7,    22,    37,    53,    70,    88,   108,   127,
+      146,   167,   189,   212,   238,   265,   298,   336,
+      377,   420,   467,   519,   576,   646,   729,   829,
+      953,  1082,  1213,  1345,  1460,  1564,  1660,  1742,
+     1814,  1877,  1928,  1972,  2007,  2032,  2043,  2040,
+     2028,  2000,  1958,  1900,  1822,  1733,  1626,  1498,
+     1365,  1222,  1063,   905,   741,   565,   394,   220,
+       39,  -130,  -306,  -469,  -628,  -789,  -935, -1075,
+    -1213, -1333, -1443, -1547, -1634, -1714, -1787, -1849,
+    -1902, -1950, -1985, -2012, -2032, -2042, -2045, -2043,
+    -2035, -2022, -2004, -1983, -1960, -1938, -1922, -1909,
+    -1899, -1891, -1877, -1852, -1816, -1772, -1720, -1669,
+    -1616, -1560, -1499, -1420, -1330, -1231, -1125, -1027,
+     -935,  -846,  -770,  -700,  -634,  -577,  -525,  -474,
+     -428,  -386,  -346,  -312,  -281,  -250,  -220,  -192,
+     -161,  -134,  -109,   -86,   -65,   -44,   -26,    -9,
+};
+const int8_t wavetable_1_ofs[1024] PROGMEM = {
+      -7,   -5,   -4,   -2,   -1,    3,    4,    6,
+      -8,   -6,   -3,   -1,    0,    2,    4,    7,
+      -7,   -5,   -4,   -1,    1,    3,    4,    6,
+      -7,   -5,   -4,   -2,    0,    3,    5,    6,
+      -9,   -7,   -3,   -1,    0,    2,    4,    8,
+      -8,   -6,   -4,    0,    1,    4,    6,    8,
+      -8,   -6,   -4,   -2,    0,    4,    6,    8,
+      -9,   -7,   -3,   -1,    1,    3,    5,    9,
+      -8,   -6,   -4,    0,    2,    4,    6,    8,
+      -9,   -6,   -4,   -2,    0,    4,    7,    9,
+     -11,   -8,   -4,   -1,    1,    3,    8,   10,
+     -10,   -8,   -5,    0,    2,    5,    7,   10,
+     -11,   -9,   -6,   -3,   -1,    5,    8,   10,
+     -14,  -11,   -5,   -2,    2,    5,   11,   14,
+     -15,  -12,   -8,   -1,    2,    6,   10,   14,
+     -17,  -13,   -9,   -5,   -1,    7,   12,   16,
+     -21,  -16,   -8,   -3,    1,    6,   15,   20,
+     -19,  -14,  -10,    0,    4,    9,   13,   18,
+     -20,  -15,  -10,   -5,    0,   10,   15,   20,
+     -26,  -15,  -10,   -4,    1,    6,   19,   25,
+     -26,  -20,  -14,   -2,    4,   11,   18,   25,
+     -32,  -25,  -19,  -10,   -2,   14,   23,   31,
+     -44,  -26,  -16,   -6,    4,   13,   33,   43,
+     -46,  -34,  -23,   -1,   11,   22,   33,   46,
+     -52,  -40,  -27,  -14,   -1,   25,   39,   52,
+     -63,  -35,  -22,   -8,    6,   20,   48,   62,
+     -55,  -41,  -27,    0,   13,   27,   40,   54,
+     -51,  -38,  -26,  -13,   13,   26,   38,   51,
+     -52,  -28,  -17,   -5,    7,   19,   41,   52,
+     -41,  -31,  -20,    1,   12,   22,   31,   41,
+     -36,  -26,  -17,   -7,   10,   19,   28,   36,
+     -37,  -20,  -12,   -4,    4,   12,   28,   36,
+     -28,  -22,  -15,   -1,    6,   13,   20,   27,
+     -24,  -18,  -12,   -6,    7,   13,   18,   23,
+     -22,  -12,   -7,   -1,    4,    8,   17,   22,
+     -18,  -13,   -8,    0,    4,    7,   11,   18,
+     -13,   -9,   -6,   -3,    3,    6,    9,   13,
+      -9,   -5,   -3,   -1,    1,    3,    7,    8,
+      -2,   -1,   -1,    1,    1,    2,    2,    1,
+       3,    3,    3,    2,    1,   -1,   -2,   -3,
+       8,    6,    4,    2,    0,   -3,   -7,   -9,
+      16,   14,   10,    3,   -1,   -5,   -8,  -16,
+      21,   16,   11,    6,   -4,   -9,  -14,  -21,
+      31,   18,   12,    6,   -1,   -7,  -23,  -31,
+      39,   31,   16,    8,   -2,  -11,  -20,  -39,
+      41,   31,   22,   11,  -10,  -21,  -32,  -42,
+      54,   31,   19,    7,   -5,  -17,  -42,  -54,
+      61,   47,   21,    7,   -6,  -20,  -33,  -61,
+      57,   43,   29,   15,  -13,  -28,  -43,  -58,
+      70,   39,   24,    9,   -7,  -38,  -54,  -70,
+      73,   57,   25,    8,   -8,  -25,  -41,  -74,
+      67,   50,   33,   16,  -18,  -34,  -51,  -68,
+      78,   44,   26,    9,   -8,  -43,  -61,  -79,
+      80,   62,   27,    9,   -9,  -27,  -45,  -81,
+      72,   54,   36,   18,  -18,  -37,  -55,  -73,
+      82,   46,   28,    9,   -9,  -45,  -64,  -82,
+      81,   63,   27,    9,   -9,  -27,  -45,  -81,
+      71,   53,   35,   17,  -18,  -36,  -54,  -72,
+      70,   52,   34,   17,    0,  -35,  -52,  -70,
+      76,   59,   25,    8,   -9,  -26,  -42,  -76,
+      66,   50,   33,   17,  -17,  -33,  -50,  -66,
+      63,   47,   31,   15,   -1,  -32,  -47,  -63,
+      68,   53,   22,    6,   -8,  -23,  -38,  -68,
+      57,   43,   28,   14,  -14,  -28,  -43,  -57,
+      53,   40,   27,   14,    0,  -26,  -39,  -53,
+      55,   43,   18,    5,   -7,  -19,  -32,  -55,
+      44,   32,   21,   -2,  -13,  -24,  -34,  -44,
+      39,   29,   18,    8,   -1,  -20,  -29,  -39,
+      39,   29,   11,    3,   -6,  -14,  -23,  -40,
+      31,   23,   16,    0,   -8,  -15,  -23,  -31,
+      28,   20,   13,    6,   -1,  -15,  -22,  -28,
+      27,   21,    8,    2,   -5,  -10,  -16,  -27,
+      20,   15,    9,   -1,   -6,  -11,  -16,  -21,
+      17,   12,    8,    4,    0,   -9,  -13,  -17,
+      14,   10,    4,    0,   -3,   -6,  -13,  -15,
+       9,    7,    4,   -1,   -3,   -6,   -8,  -10,
+       6,    4,    2,    1,   -1,   -4,   -5,   -6,
+       3,    2,   -1,   -1,   -1,   -2,   -3,   -3,
+       0,   -1,   -1,    0,    0,    0,    0,    0,
+      -2,   -1,   -1,   -1,    0,    1,    1,    2,
+      -5,   -4,   -2,   -1,    0,    1,    3,    5,
+      -7,   -5,   -4,   -1,    1,    3,    4,    6,
+      -8,   -7,   -5,   -3,   -1,    4,    6,    8,
+     -11,   -6,   -4,   -1,    1,    4,    9,   11,
+      -9,   -7,   -5,    0,    3,    5,    7,    9,
+      -8,   -6,   -4,   -2,    0,    4,    6,    8,
+      -7,   -3,   -1,    0,    2,    3,    6,    7,
+      -5,   -3,   -2,    0,    1,    2,    3,    4,
+      -4,   -3,   -2,   -2,   -1,    1,    2,    3,
+      -5,   -3,   -2,   -1,    0,    1,    3,    4,
+      -8,   -7,   -5,   -3,   -1,    1,    4,    7,
+     -13,  -11,   -8,   -5,    2,    6,    9,   13,
+     -19,  -12,   -7,   -3,    2,    6,   15,   19,
+     -20,  -15,  -10,   -1,    4,    9,   14,   19,
+     -22,  -17,  -12,   -6,    4,    9,   15,   21,
+     -25,  -14,   -8,   -3,    3,    8,   20,   25,
+     -22,  -17,  -11,    0,    6,   11,   17,   22,
+     -23,  -17,  -12,   -6,    6,   11,   17,   23,
+     -32,  -19,  -12,   -5,    2,    9,   22,   31,
+     -40,  -32,  -23,   -6,    2,   10,   20,   39,
+     -41,  -31,  -21,  -12,    9,   19,   30,   40,
+     -48,  -27,  -16,   -6,    5,   16,   37,   48,
+     -48,  -37,  -26,   -5,    5,   16,   26,   47,
+     -40,  -30,  -20,  -10,   11,   21,   31,   40,
+     -42,  -23,  -13,   -4,    6,   16,   33,   42,
+     -38,  -30,  -21,   -3,    5,   13,   21,   37,
+     -31,  -23,  -14,   -7,    8,   15,   23,   30,
+     -32,  -18,  -11,   -4,    3,   10,   24,   31,
+     -29,  -22,   -9,   -3,    4,   10,   17,   28,
+     -23,  -17,  -11,   -5,    7,   12,   18,   23,
+     -24,  -13,   -8,   -3,    3,    8,   18,   23,
+     -23,  -18,   -8,   -3,    2,    7,   12,   22,
+     -19,  -14,   -9,   -5,    5,   10,   14,   19,
+     -19,  -10,   -6,   -1,    3,    7,   15,   19,
+     -17,  -13,   -5,   -1,    2,    6,   10,   17,
+     -14,  -10,   -7,   -3,    3,    7,   10,   13,
+     -15,   -8,   -5,   -2,    1,    8,   11,   14,
+     -14,  -11,   -4,   -1,    2,    5,    8,   14,
+     -13,  -10,   -6,   -3,    3,    6,    9,   12,
+     -14,   -8,   -5,   -2,    1,    8,   11,   14,
+     -14,  -11,   -5,   -2,    1,    4,    7,   13,
+     -11,   -8,   -5,   -3,    3,    5,    8,   10,
+     -10,   -7,   -5,   -2,    0,    5,    7,   10,
+     -11,   -9,   -4,   -1,    1,    3,    6,   10,
+      -9,   -6,   -4,   -2,    2,    4,    6,    8,
+      -8,   -6,   -4,   -2,    0,    4,    6,    7,
+      -9,   -7,   -3,   -1,    1,    3,    5,    8,
+      -7,   -5,   -4,   -2,    1,    3,    4,    6,
+};
+
+const uint8_t wavetable_2_p12[1537] PROGMEM = {
+       9,  216,  128,   15,  248,  128,   18,   72,
+     129,   22,  168,  129,   30,   40,  130,   38,
+     168,  130,   46,   40,  131,   54,  168,  131,
+      62,   40,  132,   70,  168,  132,   78,   40,
+     133,   86,  168,  133,   92,  248,  133,   97,
+      88,  134,  105,  216,  134,  113,  136,  135,
+     124,    8,  136,  131,  120,  136,  135,  120,
+     136,  143,  104,  137,  158,   40,  138,  165,
+     216,  138,  180,  200,  139,  192,   72,  140,
+     203,   56,  141,  214,  168,  141,  226,  152,
+     142,  248,  200,  143,    0,  249,  144,   30,
+      41,  146,   38,  217,  146,   68,  185,  148,
+      79,   57,  149,   98,  153,  150,  113,   89,
+     151,  121,    9,  152,  143,   57,  153,  151,
+     233,  153,  166,   89,  155,  185,  201,  155,
+     196,   57,  157,  211,  121,  157,  226,  169,
+     158,  249,  153,  159,    0,   10,  160,    8,
+     250,  160,   15,  250,  160,   23,  122,  161,
+      23,  122,  161,   23,  122,  161,   23,  186,
+     161,   31,  250,  161,   31,  250,  161,   31,
+     106,  162,   38,  250,  161,   31,  250,  161,
+      31,  250,  161,   31,  250,  161,   31,  122,
+     161,   23,  122,  161,   23,  122,  161,   23,
+     122,  161,   23,  122,  161,   23,  122,  161,
+      31,  250,  161,   31,  250,  161,   31,  250,
+     161,   34,  106,  162,   38,  234,  162,   46,
+      26,  163,   53,   90,  163,   61,  218,  163,
+      61,   74,  164,   68,  202,  164,   76,  202,
+     164,   76,   58,  165,   87,  186,  165,   91,
+      42,  166,  106,  170,  166,  106,   26,  167,
+     121,   26,  168,  132,  138,  168,  144,  250,
+     169,  159,  106,  170,  181,  218,  171,  196,
+     138,  172,  212,   58,  174,  242,   26,  176,
+       5,  139,  176,   23,  235,  178,   50,  219,
+     179,   76,  187,  181,  106,  235,  182,  114,
+      27,  184,  137,   11,  185,  148,  139,  185,
+     174,  107,  187,  186,  219,  187,  197,  203,
+     189,  227,  123,  190,  235,  171,  191,    1,
+     156,  192,   13,   12,  193,   24,  252,  193,
+      39,  252,  194,   54,  108,  195,   62,   28,
+     196,   69,  220,  196,   84,  204,  197,   92,
+     204,  197,   99,   60,  198,  103,  188,  198,
+     107,   44,  199,  122,  172,  199,  122,  172,
+     199,  130,   44,  200,  133,  156,  200,  137,
+     156,  200,  141,   28,  201,  145,   28,  201,
+     152,  140,  201,  152,  140,  201,  152,  204,
+     201,  160,  124,  202,  182,  108,  203,  186,
+     236,  203,  197,  220,  204,  220,   12,  206,
+     235,  172,  207,    9,  157,  208,   24,   13,
+     210,   47,  237,  211,   66,   93,  213,  107,
+      45,  216,  145,   93,  217,  168,  237,  219,
+     205,  221,  220,  221,  205,  222,  251,   45,
+     224,    2,   30,  225,   25,  142,  226,   48,
+      62,  227,   55,  110,  228,   78,   30,  229,
+      85,  222,  229,  100,  206,  230,  112,  190,
+     231,  130,   46,  232,  138,  238,  232,  146,
+      46,  233,  153,  158,  233,  161,   30,  234,
+     161,  142,  234,  168,  142,  234,  168,  142,
+     234,  176,   14,  235,  176,   14,  235,  183,
+     126,  235,  183,  126,  235,  191,  254,  235,
+     191,  254,  235,  191,  110,  236,  198,  110,
+     236,  198,  110,  236,  198,  110,  236,  206,
+     238,  236,  206,  238,  236,  206,  238,  236,
+     206,  238,  236,  206,  238,  236,  206,  238,
+     236,  198,  110,  236,  198,  110,  236,  198,
+     254,  235,  191,  254,  235,  191,  254,  235,
+     187,  126,  235,  183,  126,  235,  176,   14,
+     235,  176,  142,  234,  168,   30,  234,  161,
+     158,  233,  153,   46,  233,  142,  174,  232,
+     130,  190,  231,  115,   14,  231,  108,   78,
+     230,   93,   94,  229,   81,  110,  228,   63,
+      14,  227,   48,  142,  226,   25,   30,  225,
+       2,   46,  224,  251,  205,  222,  228,   93,
+     221,  213,  221,  220,  198,  237,  219,  190,
+     253,  218,  168,   13,  218,  153,   93,  217,
+     145,  173,  216,  130,  173,  215,  122,  173,
+     215,  115,   61,  215,  111,  189,  214,  107,
+      77,  214,  100,   13,  214,   92,  205,  213,
+      85,   93,  213,   81,  221,  212,   77,  109,
+     212,   70,  109,  212,   62,  237,  211,   62,
+     237,  211,   62,  125,  211,   55,  125,  211,
+      47,  253,  210,   47,  253,  210,   43,  125,
+     210,   39,   13,  210,   24,  141,  209,   24,
+      29,  209,   17,  221,  208,    2,  173,  207,
+     243,  188,  206,  235,   76,  206,  213,  220,
+     204,  190,  236,  203,  182,  252,  202,  167,
+     124,  202,  152,   28,  201,  137,   44,  200,
+     126,   44,  199,   99,  204,  197,   84,   28,
+     197,   69,  108,  195,   31,  252,  193,   16,
+      28,  192,  242,  203,  189,  220,  203,  188,
+     182,  251,  185,  137,   91,  184,  114,  187,
+     181,   69,   27,  180,   54,  123,  178,   23,
+     139,  176,    5,  155,  175,  242,   58,  174,
+     219,  186,  173,  212,  202,  172,  196,   74,
+     172,  189,   90,  171,  174,  106,  170,  163,
+     122,  169,  151,  138,  168,  129,   26,  168,
+     121,  170,  166,   83,   10,  165,   68,  234,
+     162,   31,  138,  160,    4,   26,  159,  219,
+     201,  156,  200,  201,  155,  173,  233,  153,
+     143,  185,  152,  128,  153,  150,   83,  201,
+     147,   56,  249,  144,  218,  232,  137,  154,
+      24,  135,   75,   72,  131,   30,  168,  129,
+       0,   24,  127,  234,   39,  126,  222,   55,
+     125,  204,  215,  123,  185,   87,  123,  173,
+     103,  122,  151,  119,  121,  143,  135,  120,
+     128,  151,  119,  121,   23,  119,  113,  167,
+     118,  102,   39,  118,   90,  167,  117,   83,
+     247,  116,   75,   71,  116,   60,   87,  115,
+      49,  215,  114,   38,  231,  113,   26,  119,
+     113,   15,  119,  112,    0,  199,  111,  241,
+     150,  110,  226,   54,  109,  207,   70,  108,
+     173,  246,  104,  143,  134,  103,   82,   86,
+      98,    7,   54,   96,  233,   37,   93,  180,
+      85,   90,  161,  229,   88,  142,  245,   87,
+     127,  245,   87,  112,    5,   87,  105,   85,
+      86,   97,  149,   85,   82,   37,   85,   74,
+     165,   84,   67,   53,   84,   63,  181,   83,
+      59,   69,   83,   52,    5,   83,   44,  197,
+      82,   37,   85,   82,   37,   85,   82,   29,
+     213,   81,   25,  101,   81,   14,  117,   80,
+       7,   53,   80,  255,  116,   79,  247,  116,
+      79,  247,    4,   79,  232,  132,   78,  229,
+      20,   78,  217,   36,   77,  210,  228,   76,
+     202,   52,   76,  187,  180,   75,  187,   68,
+      75,  172,  196,   74,  168,   68,   74,  157,
+      84,   73,  149,   36,   73,  142,  100,   72,
+     127,  180,   71,  119,  132,   70,   97,  148,
+      69,   85,   20,   69,   66,  180,   67,   44,
+     132,   66,   36,   84,   65,   14,  164,   64,
+       6,  116,   63,  224,  163,   60,  202,  179,
+      59,  164,   83,   57,  134,   35,   56,  119,
+     131,   54,   89,   83,   53,   73,   35,   52,
+      51,   51,   51,   47,  179,   50,   36,   67,
+      50,   36,   67,   50,   28,  195,   49,   21,
+      83,   49,   21,   83,   49,   13,  211,   48,
+      13,   99,   48,    6,  227,   47,  254,  226,
+      47,  254,  226,   47,  246,   98,   47,  246,
+     242,   46,  239,  114,   46,  231,  114,   46,
+     231,    2,   46,  224,    2,   46,  216,   18,
+      45,  209,   18,   45,  209,  146,   44,  194,
+      34,   44,  190,  162,   43,  179,   50,   43,
+     175,  178,   42,  164,  194,   41,  148,   66,
+      41,  141,   82,   40,  126,   98,   39,  118,
+      98,   39,  111,  114,   38,  103,    2,   38,
+      88,   18,   37,   73,   82,   36,   58,   34,
+      35,   35,   66,   33,   20,   66,   33,    5,
+      98,   31,  246,  225,   30,  231,  129,   29,
+     208,  209,   28,  193,  161,   27,  171,   49,
+      26,  159,  177,   25,  140,  209,   23,  122,
+     225,   22,   88,  145,   20,   50,   33,   19,
+      35,   65,   17,    5,   81,   16,  246,  224,
+      14,  223,  240,   13,  219,    0,   13,  193,
+     144,   11,  178,  224,   10,  170,  160,   10,
+     163,   48,   10,  155,  176,    9,  155,  176,
+       9,  155,  176,    9,  155,  176,    9,  155,
+     240,    9,  163,   48,   10,  163,   96,   10,
+     170,   32,   11,  178,   32,   11,  181,  144,
+      11,  193,   16,   12,  200,  128,   12,  208,
+       0,   13,  215,  112,   13,  215,  240,   13,
+     230,   96,   14,  234,   96,   15,  246,  208,
+      15,    5,  129,   16,   12,  193,   16,   20,
+     113,   17,   27,   49,   18,   42,  161,   18,
+      46,   33,   19,   57,   17,   20,   73,  193,
+      20,   80,  129,   21,   95,   49,   22,  103,
+     225,   22,  118,  209,   23,  133,   65,   25,
+     155,  177,   26,  173,    1,   27,  178,  161,
+      27,  201,  209,   28,  208,  241,   29,  231,
+      97,   31,  250,  225,   31,   13,   66,   33,
+      28,   50,   34,   43,   34,   35,   65,   82,
+      36,   73,  130,   37,   96,  242,   38,  114,
+      98,   39,  126,  210,   40,  145,  194,   41,
+     164,   50,   43,  186,  226,   43,  201,   18,
+      45,  224,   98,   47,  250,  226,   47,   21,
+     179,   50,   47,   51,   51,   73,    3,   54,
+     119,  163,   55,  149,  195,   58,  202,    3,
+      62,  232,   83,   65,   74,  244,   71,  134,
+      68,   75,  240,  196,   82,   82,  149,   85,
+     112,  229,   88,  172,  197,   91,  195,  165,
+      93,  248,  101,   97,   30,  214,   98,   60,
+     166,  101,  120,    6,  104,  135,  102,  105,
+     165,   70,  107,  188,   70,  108,  211,   38,
+     110,  233,   22,  111,    0,  247,  112,   30,
+     103,  114,   45,  199,  115,   75,   55,  117,
+      90,   39,  118,  106,  151,  119,  132,  247,
+     120,  151,  231,  121,  173,   39,  123,  183,
+     215,  123,  204,   23,  125,  214,  183,  125,
+     234,   23,  127,  249,    7,  128,   14,  104,
+     129,   30,   88,  130,   45,   72,  131,   60,
+      24,  132,   70,  184,  132,   90,  248,  133,
+     100,  152,  134,  120,    8,  136,  135,  200,
+     136,  145,  104,  137,  153,  184,  137,  158,
+      88,  138,  173,   40,  139,  183,  232,  145,
+       0,
+};
+
+const int16_t wavetable_3_base[128] PROGMEM = {
+       24,    58,    81,   104,   153,   202,   275,   352,
+      473,   605,   696,   792,   880,   951,   994,  1013,
+     1026,  1039,  1046,  1054,  1062,  1069,  1074,  1087,
+     1101,  1118,  1133,  1156,  1191,  1230,  1271,  1310,
+     1352,  1395,  1446,  1503,  1560,  1620,  1673,  1726,
+     1786,  1840,  1887,  1928,  1949,  1955,  1957,  1950,
+     1937,  1910,  1858,  1805,  1748,  1693,  1654,  1601,
+     1554,  1476,  1386,  1288,  1167,  1050,   911,   762,
+      590,   430,   270,   111,   -70,  -246,  -404,  -555,
+     -688,  -808,  -923, -1033, -1159, -1250, -1331, -1423,
+    -1493, -1576, -1660, -1719, -1781, -1838, -1872, -1883,
+    -1894, -1902, -1902, -1902, -1902, -1902, -1898, -1888,
+    -1872, -1853, -1812, -1768, -1704, -1643, -1593, -1534,
+    -1479, -1415, -1336, -1268, -1199, -1125, -1064, -1016,
+     -986,  -955,  -929,  -903,  -872,  -853,  -827,  -774,
+     -680,  -521,  -370,  -231,  -136,   -70,   -31,    -5,
+};
+const int8_t wavetable_3_ofs[1024] PROGMEM = {
+     -24,  -21,  -16,   -8,    0,    8,   19,   23,
+     -11,  -11,   -4,   -4,   -4,    0,    4,   11,
+     -12,  -12,   -4,   -4,    0,    3,   11,   11,
+     -12,  -12,   -4,   -4,    3,    7,   11,   11,
+     -23,  -19,  -16,  -16,   -1,    7,    7,   22,
+     -19,  -16,  -12,   -4,   11,   11,   18,   18,
+     -40,  -25,  -25,  -25,   -9,    6,   13,   40,
+     -34,  -26,  -19,   -4,   -4,   12,   27,   34,
+     -57,  -49,  -49,  -19,    7,   11,   34,   57,
+     -45,  -42,  -38,  -15,   -8,   15,   15,   45,
+     -38,  -27,  -23,   -8,   -1,   22,   37,   37,
+     -51,  -36,  -14,   -6,    2,   17,   24,   51,
+     -34,  -34,  -11,   -3,   -3,   12,   27,   34,
+     -25,  -22,   -7,    1,    8,    8,   16,   24,
+     -12,   -4,   -4,    3,    3,    3,    3,   11,
+      -8,   -1,   -1,   -1,   -1,    7,    7,    7,
+      -6,    1,    1,    1,    1,    1,    1,    5,
+      -4,   -4,   -4,    3,    3,    3,    3,    3,
+      -4,   -4,   -4,   -4,    4,    4,    4,    4,
+      -4,    0,    4,    4,    4,    4,    4,    4,
+      -4,   -4,   -4,   -4,   -4,    3,    3,    3,
+      -4,   -4,   -4,   -4,   -4,   -4,   -4,    4,
+      -1,   -1,   -1,   -1,   -1,   -1,   -1,    1,
+      -9,   -7,   -7,   -7,    1,    1,    1,    8,
+      -6,   -2,    2,    2,    2,    2,    2,    6,
+      -8,   -8,   -4,    0,    0,    0,    4,    7,
+      -8,   -8,   -8,   -8,    0,    8,    8,    8,
+     -15,   -8,    0,    0,    0,    7,   15,   15,
+     -17,  -13,   -5,    0,    5,   10,   10,   17,
+     -17,  -12,   -6,    1,    1,    5,    9,   16,
+     -21,  -17,    0,    3,    5,   13,   17,   20,
+     -19,  -11,   -4,   -4,    4,    4,   12,   19,
+     -23,  -15,   -8,   -4,    0,    0,   15,   22,
+     -17,  -13,   -6,   -6,    2,    2,   17,   17,
+     -26,  -15,  -11,   -4,    4,    8,   11,   26,
+     -15,   -8,   -8,   -8,    0,    5,   10,   15,
+     -27,  -17,  -15,  -12,    3,   18,   18,   26,
+     -27,  -23,  -19,   -2,    1,    3,   18,   26,
+     -23,  -20,  -12,   -2,    1,    3,   18,   22,
+     -27,  -16,  -12,   -5,    3,    7,   10,   26,
+     -27,  -12,   -7,   -2,    3,   11,   26,   26,
+     -21,  -13,   -5,    2,    2,   10,   17,   21,
+     -22,  -19,  -15,  -10,   -5,    0,    0,   21,
+     -16,   -4,   -1,    6,    9,   11,   13,   15,
+      -4,   -3,   -1,   -1,    1,    2,    2,    3,
+      -3,   -1,    0,    2,    2,    3,    3,    3,
+       1,    1,    1,    1,    1,    0,   -1,   -2,
+       4,    2,    2,    1,   -1,   -2,   -3,   -4,
+       7,    7,    6,    4,    3,    0,   -2,   -7,
+      17,   11,    4,    0,   -7,  -11,  -13,  -18,
+      22,    7,    7,    7,   -1,   -8,  -23,  -23,
+      30,   22,   14,   -1,   -1,   -8,  -16,  -31,
+      26,   19,   11,    4,  -12,  -12,  -19,  -27,
+      13,   13,   13,    6,    2,   -9,  -12,  -14,
+      22,   15,   11,   -1,   -1,   -8,  -23,  -23,
+      22,   22,    7,    7,    0,   -8,  -15,  -23,
+      20,    9,    1,    9,  -14,  -16,  -19,  -21,
+      34,   19,   15,   12,   -4,  -26,  -30,  -34,
+      41,   19,   14,    8,  -12,  -23,  -34,  -42,
+      49,   34,   18,    7,   -4,  -27,  -34,  -49,
+      64,   57,   19,   14,    9,    4,  -19,  -64,
+      53,   42,   30,    0,   -5,  -10,  -30,  -53,
+      64,   26,   15,    3,  -12,  -22,  -32,  -65,
+      62,   39,   16,    1,  -36,  -44,  -51,  -63,
+      75,   53,   23,   11,    0,  -11,  -53,  -76,
+      73,   62,   24,   -6,  -14,  -21,  -59,  -74,
+      71,   60,   48,   11,   -4,  -16,  -27,  -72,
+      64,   41,   34,   26,  -27,  -42,  -53,  -64,
+      71,   50,   35,   27,   -3,  -41,  -63,  -71,
+      75,   75,   37,   30,   22,  -16,  -61,  -76,
+      75,   67,   22,    7,   -5,  -16,  -46,  -76,
+      60,   52,   14,   14,  -23,  -31,  -46,  -61,
+      49,   34,   23,   12,   -3,  -34,  -41,  -49,
+      49,   34,   11,    3,   -4,  -27,  -42,  -49,
+      58,   13,    5,   -2,  -10,  -40,  -55,  -58,
+      50,   25,   10,   -5,  -13,  -43,  -47,  -51,
+      38,   34,   22,    7,  -15,  -18,  -20,  -38,
+      30,   25,   20,    0,   -7,  -22,  -26,  -30,
+      36,   13,    6,    1,   -4,  -32,  -34,  -37,
+      38,   26,   15,    7,    0,   -8,  -19,  -38,
+      27,   22,   17,    9,    2,   -6,  -21,  -28,
+      47,   43,    6,  -13,  -17,  -32,  -32,  -47,
+      22,   22,    7,   -1,   -8,  -16,  -16,  -23,
+      24,   20,   13,    5,  -10,  -17,  -17,  -25,
+      30,   11,    7,    7,  -16,  -16,  -31,  -31,
+      26,    4,    4,    4,  -11,  -19,  -26,  -26,
+       8,    0,    0,   -3,   -5,   -8,   -8,   -8,
+       3,    3,   -4,   -4,   -4,   -4,   -4,   -4,
+       7,    7,   -1,   -1,   -1,   -3,   -6,   -8,
+       0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,
+      -4,   -4,   -4,   -4,   -4,    3,    3,    3,
+      -7,   -7,   -3,    1,    1,    1,    3,    6,
+      -8,   -8,    0,    0,    0,    4,    8,    8,
+     -11,  -11,  -11,   -1,    1,    4,   11,   11,
+     -15,  -13,  -11,   -9,   -7,    0,    8,   14,
+     -25,  -19,  -14,    9,   13,   17,   20,   24,
+     -25,  -22,  -20,  -17,   -2,    5,   13,   24,
+     -25,  -18,    1,    9,    9,   12,   24,   24,
+     -19,  -11,   -6,   -1,    4,    9,   14,   19,
+     -25,  -17,   -2,   -2,    5,   13,   20,   24,
+     -27,  -20,   -5,    3,    3,   11,   18,   26,
+     -31,  -23,   -8,   -1,    7,   11,   22,   30,
+     -27,  -23,  -19,  -12,   -4,    0,   18,   26,
+     -27,  -19,  -16,  -12,    3,   18,   22,   26,
+     -36,  -21,   -5,   -2,   17,   17,   32,   36,
+     -34,  -27,  -19,  -14,   -9,    4,   19,   34,
+     -27,  -20,  -12,    3,   10,   14,   18,   26,
+     -15,  -15,  -15,    0,    0,    0,    8,   15,
+     -15,   -7,   -3,    0,    8,   10,   13,   15,
+     -16,  -16,   -1,   -1,   -1,    7,   15,   15,
+     -11,  -11,   -4,   -4,   -1,    1,   11,   11,
+     -15,  -15,   -7,   -7,   -2,    3,    8,   15,
+     -16,  -16,   -8,   -1,    7,    7,   15,   15,
+      -4,   -4,   -4,   -4,    3,    3,    3,    3,
+     -23,  -23,  -15,   -8,   -8,   -4,    7,   22,
+     -23,  -23,  -23,   -8,    0,   15,   15,   22,
+     -57,  -22,  -15,   -7,    8,   38,   53,   57,
+     -75,  -60,  -30,  -26,    8,   15,   45,   75,
+     -76,  -61,  -30,   -8,   -4,   22,   45,   75,
+     -49,  -45,  -11,    4,   19,   23,   42,   49,
+     -30,  -27,  -15,    0,    7,   22,   26,   30,
+     -21,  -14,  -10,   -6,    2,   17,   17,   20,
+     -15,   -7,    0,    0,    0,    8,    8,   15,
+      -7,   -5,   -3,   -2,   -1,    2,    7,    5,
+};
+
+const uint8_t wavetable_4_p12[1537] PROGMEM = {
+       0,  200,  132,   83,   56,  133,   98,   40,
+     134,  106,  232,  134,  113,    8,  136,  128,
+       8,  137,  144,    8,  137,  159,  104,  138,
+     174,   88,  139,  193,   72,  140,  211,  184,
+     141,  227,  168,  142,  242,  152,  143,    1,
+      25,  144,    1,  121,  145,   35,  105,  146,
+      46,  105,  147,   61,   89,  148,   91,    9,
+     150,  101,  169,  150,  121,   25,  152,  148,
+     137,  153,  152,  233,  154,  189,   25,  156,
+     197,  201,  156,  219,  185,  158,  246,  169,
+     159,    9,  218,  164,   80,   74,  165,  129,
+      26,  168,  167,  250,  170,  182,  202,  173,
+     227,  106,  175,  250,  138,  177,   62,   91,
+     181,  115,  171,  183,  145,  139,  186,  213,
+     139,  190,  236,  155,  193,   47,   60,  199,
+     119,  188,  199,  161,  236,  204,  217,  220,
+     205,    3,  173,  208,   40,   77,  211,   55,
+     237,  212,  101,   61,  216,  142,   45,  217,
+     176,   45,  221,  218,   29,  222,  248,  253,
+     223,  255,  125,  224,   22,   30,  226,   37,
+     222,  226,   60,   62,  228,   82,   46,  229,
+      90,  158,  230,  105,   14,  231,  112,   14,
+     232,  128,  126,  232,  150,   30,  234,  162,
+     126,  234,  169,  222,  234,  176,   46,  235,
+     181,  142,  235,  186,  206,  235,  191,   30,
+     236,  195,   78,  236,  198,  126,  236,  201,
+     190,  236,  204,  222,  236,  207,   14,  237,
+     209,   62,  237,  212,   94,  237,  214,  126,
+     237,  216,  174,  237,  218,  174,  237,  219,
+     206,  237,  221,  238,  237,  223,   14,  238,
+     225,   46,  238,  228,   78,  238,  229,  110,
+     238,  231,  142,  238,  234,  174,  238,  235,
+     222,  238,  238,  254,  238,  241,   46,  239,
+     243,   94,  239,  246,  126,  239,  249,  174,
+     239,  252,  206,  239,  254,  254,  239,    0,
+      47,  240,    4,   95,  240,    7,  159,  240,
+      11,  207,  240,   13,   15,  241,   16,   47,
+     241,   20,  111,  241,   24,  191,  241,   28,
+     239,  241,   32,   79,  242,   37,  111,  242,
+      40,  175,  242,   44,  223,  242,   47,   31,
+     243,   52,  127,  243,   59,  223,  243,   66,
+      63,  244,   74,  239,  244,   81,   95,  245,
+      91,  207,  245,   98,  111,  246,  104,  207,
+     246,  111,   47,  247,  118,  143,  247,  124,
+      47,  248,  132,  143,  248,  141,  255,  248,
+     147,   95,  249,  152,  191,  249,  157,   15,
+     250,  163,   95,  250,  167,  175,  250,  171,
+     223,  250,  176,   79,  251,  182,  175,  251,
+     188,  255,  251,  193,   63,  252,  197,  143,
+     252,  202,  191,  252,  205,  255,  252,  207,
+      31,  253,  209,   47,  253,  211,   95,  253,
+     214,  111,  253,  214,  111,  253,  214,  111,
+     253,  214,  111,  253,  213,   95,  253,  212,
+      63,  253,  210,   31,  253,  208,  239,  252,
+     205,  207,  252,  203,  175,  252,  200,  127,
+     252,  198,   63,  252,  195,   15,  252,  190,
+     223,  251,  186,  143,  251,  182,   95,  251,
+     181,   95,  251,  178,   15,  251,  173,  111,
+     250,  166,   79,  250,  162,   15,  250,  153,
+     159,  249,  153,  159,  249,  145,  159,  248,
+     137,  159,  248,  134,  175,  247,  122,  175,
+     247,  109,  159,  246,  104,   47,  246,   98,
+     159,  245,   88,   31,  245,   80,  239,  244,
+      73,  127,  244,   65,  207,  243,   56,   95,
+     243,   48,  223,  242,   41,  111,  242,   36,
+      31,  242,   33,  207,  241,   26,  143,  241,
+      22,   79,  241,   18,  239,  240,   13,  191,
+     240,    9,  143,  240,    5,   63,  240,    2,
+     239,  239,  251,  190,  239,  248,  126,  239,
+     243,   14,  239,  237,  222,  238,  235,  142,
+     238,  229,   62,  238,  225,  254,  237,  222,
+     190,  237,  217,  142,  237,  213,   46,  237,
+     209,  254,  236,  205,  190,  236,  200,   94,
+     236,  196,   30,  236,  190,  206,  235,  186,
+     142,  235,  182,   62,  235,  179,  254,  234,
+     173,  206,  234,  169,  126,  234,  165,   46,
+     234,  158,  238,  233,  152,  158,  232,  137,
+     174,  231,  122,   46,  231,  114,   62,  230,
+      92,  142,  229,   84,  222,  228,   69,  238,
+     227,   58,  110,  227,   39,  142,  225,   24,
+      14,  225,   16,  158,  224,  250,  109,  223,
+     242,  189,  222,  219,   77,  221,  212,   93,
+     220,  182,  125,  218,  144,   13,  217,  137,
+     157,  215,   99,   61,  214,   91,  205,  212,
+      54,  237,  210,   31,  189,  209,    8,  141,
+     208,  242,  172,  206,  219,  204,  204,  181,
+      44,  204,  134,  252,  199,   96,   44,  196,
+      29,  124,  191,  243,   59,  187,  149,  251,
+     182,  103,   11,  182,   66,   91,  177,    5,
+     235,  175,  216,  154,  172,  156,  218,  168,
+     133,  234,  167,   80,  154,  164,   43,   58,
+     162,   12,  106,  159,  216,   25,  156,  186,
+      57,  154,  148,  121,  150,   95,  121,  149,
+      65,  185,  145,   20,    9,  145,  230,  120,
+     141,  200,  168,  138,  162,  184,  137,  117,
+     104,  134,   57,   88,  131,   49,   40,  130,
+     246,  151,  124,  170,   55,  122,  140,  103,
+     119,  103,  247,  117,   91,  135,  116,   65,
+      39,  115,   27,   71,  113,    5,  215,  111,
+     230,  134,  108,  200,  150,  107,  170,   38,
+     106,  140,   70,  104,  125,  246,  101,   79,
+     134,  100,   64,  166,   98,   34,  182,   97,
+      19,   86,   95,  237,  117,   93,  215,  245,
+      92,  192,   21,   91,  162,   69,   88,  124,
+      85,   87,  102,  117,   84,   64,  133,   83,
+      49,   37,   82,   19,   69,   80,  252,   84,
+      78,  222,  100,   77,  203,    4,   76,  177,
+     164,   73,  139,  100,   72,  129,  196,   71,
+     101,  116,   68,   67,  244,   67,   48,   84,
+      66,   26,  228,   64,    3,   68,   63,  229,
+     179,   61,  209,  115,   60,  184,  147,   58,
+     161,   99,   57,  138,  179,   55,  108,   83,
+      54,   93,   99,   53,   71,  115,   51,   48,
+     131,   50,   33,  163,   48,    5,    3,   48,
+     251,   66,   46,  221,   82,   45,  206,   98,
+      44,  183,  194,   42,  145,  194,   40,   85,
+     226,   36,   74,  226,   35,   51,   18,   34,
+      16,  146,   32,    4,   98,   31,  238,  161,
+      30,  228,    1,   30,  222,  113,   29,  212,
+     225,   28,  202,   49,   28,  192,  113,   27,
+     177,  113,   26,  157,   97,   25,  129,  113,
+      23,  107,  113,   22,   96,  145,   21,   84,
+     225,   20,   72,   81,   20,   65,  177,   19,
+      57,   65,   19,   48,  225,   18,   40,   81,
+      18,   42,   17,   18,   32,  129,   17,   31,
+     209,   17,   24,   97,   17,   20,  177,   16,
+       8,   49,   16,    0,  225,   15,  251,  144,
+      15,  246,   64,   15,  241,    0,   15,  234,
+      80,   14,  227,    0,   14,  223,  208,   13,
+     219,  160,   13,  217,  112,   13,  213,   64,
+      13,  210,   16,   13,  208,  240,   12,  205,
+     192,   12,  200,   96,   12,  197,   48,   12,
+     193,  240,   11,  189,  160,   11,  184,   96,
+      11,  180,   32,   11,  175,  224,   10,  173,
+     192,   10,  172,  144,   10,  168,   96,   10,
+     166,   80,   10,  164,   48,   10,  163,   32,
+      10,  162,   32,   10,  161,    0,   10,  159,
+     240,    9,  158,  208,    9,  157,  192,    9,
+     156,  192,    9,  155,  176,    9,  155,  176,
+       9,  155,  176,    9,  156,  192,    9,  156,
+     192,    9,  156,  192,    9,  156,  192,    9,
+     157,  208,    9,  157,  208,    9,  158,  240,
+       9,  159,  240,    9,  159,    0,   10,  161,
+      16,   10,  161,   32,   10,  162,   48,   10,
+     163,   64,   10,  165,   80,   10,  167,  112,
+      10,  168,  144,   10,  170,  176,   10,  173,
+     240,   10,  176,   32,   11,  179,   80,   11,
+     184,  144,   11,  187,  224,   11,  191,    0,
+      12,  195,   96,   12,  200,  160,   12,  205,
+       0,   13,  210,   96,   13,  216,  176,   13,
+     222,    0,   14,  228,  112,   14,  233,  192,
+      14,  240,   48,   15,  247,  144,   15,  251,
+     208,   15,    2,   49,   16,    4,  161,   16,
+      12,  225,   16,   19,   97,   17,   24,  177,
+      17,   29,   33,   18,   39,  129,   18,   42,
+       1,   19,   50,   65,   19,   60,  241,   19,
+      65,   97,   20,   73,  225,   20,   80,  129,
+      21,   90,  241,   21,  100,  145,   22,  108,
+      17,   23,  119,  193,   23,  128,   81,   24,
+     141,   33,   25,  152,    1,   26,  164,  145,
+      26,  172,  161,   27,  192,  161,   28,  204,
+       1,   29,  210,   97,   29,  220,   17,   30,
+     227,   97,   30,  231,  177,   30,  236,  241,
+      30,  240,   49,   31,  244,  113,   31,  250,
+     161,   31,  253,  241,   31,    1,   50,   32,
+       7,  130,   32,   10,  178,   32,   12,  210,
+      32,   14,  242,   32,   18,   50,   33,   22,
+     114,   33,   26,  178,   33,   28,  210,   33,
+      31,   18,   34,   36,   82,   34,   38,  130,
+      34,   42,  194,   34,   45,    2,   35,   49,
+      50,   35,   52,   98,   35,   56,  146,   35,
+      59,  194,   35,   62,  242,   35,   65,   50,
+      36,   69,   98,   36,   74,  178,   36,   76,
+     226,   36,   80,   18,   37,   83,   66,   37,
+      86,  114,   37,   89,  146,   37,   91,  194,
+      37,   94,  242,   37,   96,   34,   38,  101,
+      98,   38,  106,  178,   38,  111,   18,   39,
+     118,  146,   39,  124,  242,   39,  135,  178,
+      40,  141,    2,   41,  147,   82,   41,  154,
+     210,   41,  157,   66,   42,  164,   66,   42,
+     172,   50,   43,  179,  114,   43,  187,   50,
+      44,  202,  146,   45,  217,   18,   46,  225,
+       2,   47,  255,   18,   48,    4,  227,   48,
+      29,  211,   49,   37,  179,   51,   59,  163,
+      52,   82,  147,   53,  104,  131,   55,  142,
+      99,   57,  157,  195,   58,  195,   35,   61,
+     214,  243,   63,   14,  212,   66,   60,  180,
+      68,  120,  244,   72,  165,  180,   76,  211,
+     148,   78,  248,  100,   81,   34,   69,   84,
+      90,   21,   87,  203,  117,   93,   15,   86,
+      99,   61,   22,  104,  151,   86,  107,  242,
+       6,  118,  176,  135,  125,  241,    7,  128,
+       0,
+};
+
+const int16_t wavetable_5_base[128] PROGMEM = {
+       18,    50,    76,   105,   131,   160,   197,   234,
+      287,   349,   416,   515,   599,   672,   751,   815,
+      891,   981,  1053,  1109,  1165,  1211,  1265,  1314,
+     1370,  1426,  1485,  1543,  1594,  1644,  1695,  1745,
+     1805,  1843,  1866,  1874,  1864,  1835,  1804,  1758,
+     1714,  1661,  1595,  1528,  1467,  1403,  1338,  1274,
+     1207,  1145,  1078,  1019,   962,   895,   834,   767,
+      712,   658,   603,   548,   492,   432,   372,   315,
+      252,   198,   135,    72,     9,   -55,  -117,  -180,
+     -247,  -304,  -372,  -440,  -501,  -563,  -626,  -685,
+     -760,  -843,  -915,  -987, -1056, -1125, -1195, -1265,
+    -1334, -1402, -1470, -1543, -1617, -1688, -1762, -1840,
+    -1912, -1973, -2020, -2038, -2033, -2007, -1940, -1874,
+    -1808, -1746, -1676, -1600, -1539, -1460, -1394, -1334,
+    -1266, -1181, -1093, -1012,  -932,  -838,  -741,  -658,
+     -588,  -506,  -429,  -347,  -280,  -207,  -130,   -52,
+};
+const int8_t wavetable_5_ofs[1024] PROGMEM = {
+     -18,  -13,   -8,    2,    7,    9,   15,   18,
+     -13,   -7,   -4,   -3,    2,    6,    9,   12,
+     -12,   -9,   -5,   -2,    1,    4,    6,   12,
+     -13,  -11,   -7,   -1,    2,    7,   10,   12,
+     -11,   -9,   -5,   -2,    0,    3,    7,   10,
+     -16,  -13,  -11,   -5,    1,    7,   13,   16,
+     -18,  -12,   -2,    1,    5,    8,   16,   17,
+     -14,  -11,   -8,   -6,    3,    4,   10,   14,
+     -36,  -29,  -10,  -10,  -10,    5,   20,   35,
+     -27,  -27,  -19,   -4,    3,   15,   18,   26,
+     -34,  -18,  -18,  -11,   15,   27,   31,   34,
+     -42,  -35,  -19,  -12,   -4,    3,   18,   41,
+     -36,  -25,  -14,  -10,    5,   12,   27,   35,
+     -38,  -23,   -8,    7,    7,    7,   22,   37,
+     -27,  -23,  -19,  -19,   -4,   11,   19,   26,
+     -30,   -8,   -4,    0,    7,    7,   30,   30,
+     -46,  -23,  -16,    7,   18,   30,   30,   45,
+     -30,  -27,  -23,    0,    7,   15,   23,   30,
+     -27,  -19,  -16,  -12,    3,   11,   26,   26,
+     -30,  -15,    0,    0,    8,   15,   23,   30,
+     -18,  -14,  -11,   -3,    1,    4,   15,   17,
+     -26,  -11,   -4,    0,    4,   11,   23,   26,
+     -22,  -16,  -11,   -5,   10,   14,   18,   21,
+     -24,   -1,    3,    6,   10,   14,   19,   24,
+     -27,  -16,   -4,    1,    6,   11,   18,   26,
+     -23,  -15,   -8,    0,    7,   13,   18,   23,
+     -29,  -21,  -14,   -6,    1,   13,   24,   29,
+     -24,  -19,  -11,   -4,    4,   11,   19,   24,
+     -21,  -15,  -10,   -2,    5,   10,   15,   21,
+     -22,  -14,   -9,   -4,    1,    8,   16,   21,
+     -25,  -20,   -5,    0,    5,   10,   18,   25,
+     -20,  -15,  -10,   -2,    3,    8,   13,   20,
+     -25,  -25,  -17,   -9,   -2,    6,   21,   24,
+     -11,   -8,   -4,   -3,    1,    4,    9,   11,
+      -7,   -5,   -1,    0,    2,    4,    4,    6,
+      -1,   -1,    0,    1,    1,    1,    1,    1,
+      11,   10,   10,    6,    3,   -5,  -12,  -12,
+      13,    9,    9,    9,   -6,   -6,   -6,  -14,
+      17,   10,   10,    2,   -5,   -5,  -13,  -17,
+      26,   11,   11,   -5,   -5,  -12,  -12,  -27,
+      17,   13,    9,    2,   -6,   -6,   -9,  -17,
+      29,   14,    9,    4,   -1,  -13,  -24,  -29,
+      32,   27,   16,    4,   -7,  -18,  -26,  -33,
+      29,   24,   19,   11,    4,  -19,  -24,  -29,
+      27,   12,   -3,   -8,  -13,  -18,  -23,  -28,
+      30,   20,   10,    0,   -7,  -15,  -22,  -30,
+      25,   15,    5,   -3,  -10,  -15,  -20,  -25,
+      29,   19,    9,    4,   -1,   -6,  -18,  -29,
+      30,   23,   15,   10,    5,    0,  -15,  -30,
+      27,   22,   17,    6,   -6,  -13,  -21,  -28,
+      27,   16,   12,    8,    5,    1,  -22,  -27,
+      27,   22,   17,   12,    7,   -8,  -23,  -27,
+      26,   23,   19,    4,  -11,  -16,  -21,  -26,
+      26,   18,   10,    3,   -5,  -12,  -20,  -27,
+      26,   19,    4,    0,   -4,   -8,  -12,  -27,
+      25,   20,   15,   10,    3,   -5,  -15,  -25,
+      20,   12,    5,    1,   -3,   -6,  -10,  -20,
+      24,   14,    9,    4,   -1,   -9,  -17,  -24,
+      23,   18,   13,    8,   -3,  -14,  -19,  -24,
+      26,   18,   10,    3,   -5,  -12,  -20,  -27,
+      24,   19,    6,   -1,   -7,  -13,  -18,  -24,
+      28,   13,    8,    3,   -2,  -17,  -23,  -28,
+      26,   20,    5,    3,    0,   -2,  -25,  -27,
+      27,   25,   10,    2,   -5,  -13,  -21,  -28,
+      20,   17,   15,   12,   -3,   -8,  -14,  -20,
+      29,   13,    6,   -2,   -9,  -17,  -24,  -29,
+      29,   24,    9,   -3,  -14,  -19,  -24,  -29,
+      28,   23,   17,   11,   -4,  -19,  -24,  -29,
+      29,   18,    6,    6,   -5,  -15,  -23,  -30,
+      26,   19,   11,    3,   -4,  -12,  -19,  -27,
+      24,   13,    9,    5,   -2,  -10,  -18,  -25,
+      30,   23,   15,   -7,  -13,  -19,  -24,  -30,
+      22,   16,   11,    5,   -1,   -8,  -16,  -23,
+      26,   19,    7,   -4,   -8,  -12,  -19,  -27,
+      34,   22,   11,    4,   -4,  -11,  -19,  -34,
+      26,   19,   11,    0,  -11,  -16,  -21,  -26,
+      27,   19,   12,    4,   -3,  -14,  -26,  -28,
+      31,   29,    6,    1,   -4,   -9,  -20,  -32,
+      24,   16,    9,   -3,  -14,  -18,  -21,  -25,
+      30,    7,    2,   -4,  -10,  -15,  -23,  -30,
+      37,   14,    7,   -1,   -8,  -16,  -23,  -38,
+      30,   25,   19,   14,   -1,  -16,  -23,  -31,
+      34,   26,   19,    9,   -2,  -12,  -27,  -34,
+      30,   23,   15,    8,    0,   -7,  -15,  -30,
+      29,   19,    9,   -6,  -12,  -18,  -23,  -29,
+      29,   17,   10,    2,   -5,  -13,  -20,  -30,
+      30,   19,   12,    4,   -3,  -11,  -18,  -30,
+      29,   22,   14,    6,   -1,   -9,  -19,  -29,
+      30,   23,   15,    8,    0,   -7,  -19,  -30,
+      30,   23,   15,    4,   -7,  -15,  -22,  -30,
+      30,   23,   15,    8,   -7,  -15,  -22,  -30,
+      32,   20,   10,    0,  -10,  -17,  -25,  -32,
+      34,   27,   11,   -4,  -11,  -19,  -26,  -34,
+      30,   22,   15,    7,   -8,  -16,  -23,  -31,
+      36,   21,   13,    6,   -2,  -17,  -32,  -37,
+      36,   31,   16,    4,   -7,  -11,  -14,  -37,
+      27,   20,   15,   10,    5,  -28,  -28,  -28,
+      26,   10,    3,  -12,  -15,  -17,  -20,  -27,
+      17,   -6,   -6,  -10,  -13,  -14,  -16,  -17,
+       1,    0,   -1,   -1,   -1,   -1,   -1,   -1,
+      -6,   -6,   -6,   -5,   -2,   -1,    2,    5,
+     -18,  -16,  -16,   -1,    7,   12,   14,   17,
+     -28,  -23,  -18,  -12,   10,   16,   21,   27,
+     -33,  -18,  -11,   -3,    7,   17,   27,   32,
+     -29,  -24,  -12,   -1,   14,   19,   24,   29,
+     -25,  -18,  -14,  -10,   -3,    5,   15,   25,
+     -35,  -28,  -16,   -5,   10,   25,   30,   35,
+     -21,  -16,  -11,   -5,   10,   13,   17,   21,
+     -36,  -14,   -6,    1,    9,   16,   24,   35,
+     -32,  -21,  -10,   -5,    0,    5,   20,   32,
+     -23,  -19,  -15,  -12,    7,   12,   17,   22,
+     -26,  -15,  -10,   -5,    0,   11,   23,   26,
+     -38,  -23,  -15,   -8,    0,    7,   30,   38,
+     -44,  -32,  -17,  -10,   13,   17,   21,   43,
+     -37,  -30,  -22,  -15,    0,    8,   31,   36,
+     -40,  -35,  -20,  -13,   -9,    2,   10,   40,
+     -37,  -35,  -17,  -17,   20,   23,   26,   36,
+     -43,  -28,  -24,   -6,    9,   25,   32,   43,
+     -42,  -20,  -12,   -7,   -2,   18,   33,   41,
+     -27,  -22,  -17,  -12,   -5,    7,   18,   26,
+     -37,  -22,  -18,  -14,    8,   16,   31,   36,
+     -41,  -21,  -13,    2,    9,   17,   24,   40,
+     -30,  -22,  -15,    0,    8,   23,   27,   30,
+     -36,  -21,  -14,   -6,    1,   24,   31,   35,
+     -28,  -13,   -5,    2,   15,   17,   24,   27,
+     -42,  -34,  -28,  -13,   -6,    3,   24,   42,
+     -24,  -21,  -14,   -3,    3,    9,   21,   24,
+     -50,  -46,  -28,   12,   32,   42,   47,   49,
+};
+
+const uint8_t wavetable_6_p12[1537] PROGMEM = {
+      11,  168,  130,   47,   56,  131,   56,  232,
+     131,   68,  152,  132,   79,  168,  134,  220,
+     184,  142,    2,  217,  144,   25,  137,  146,
+      70,   89,  149,  100,   57,  151,  123,   41,
+     152,  153,    9,  154,  168,  121,  155,  206,
+      57,  157,  216,  217,  157,  243,  249,  159,
+      10,  154,  161,   33,  138,  162,   48,  186,
+     163,   70,  218,  165,   98,  122,  166,  108,
+      58,  168,  142,  154,  169,  168,  250,  171,
+     199,  234,  172,  214,   90,  174,  251,  122,
+     176,   18,  155,  177,   33,  139,  179,   71,
+     235,  180,   86,  203,  182,  114,  123,  183,
+     124,   43,  185,  158,  155,  186,  184,  251,
+     187,  199,  251,  188,  229,   11,  191,  252,
+     187,  192,   22,   44,  194,   49,  140,  195,
+      64,  108,  197,  101,  220,  198,  116,   76,
+     200,  139,  172,  201,  169,  140,  203,  192,
+     124,  204,  215,  108,  206,  237,   92,  207,
+       4,  141,  208,   11,  173,  209,   30,   45,
+     210,   49,  157,  211,   62,   61,  212,   72,
+     253,  212,   94,   45,  214,  102,  221,  214,
+     117,  221,  215,  132,   61,  217,  151,  189,
+     217,  158,   45,  218,  170,  157,  219,  192,
+     141,  220,  207,   61,  221,  215,  253,  221,
+     226,  109,  222,  238,   93,  223,  248,  173,
+     223,  253,   29,  224,    4,  206,  224,   14,
+      30,  225,   19,  126,  225,   27,   46,  226,
+      38,  174,  226,   45,  254,  226,   50,  158,
+     227,   61,   30,  228,   67,  110,  228,   72,
+      14,  229,   83,  126,  229,   91,  254,  229,
+      99,  110,  230,  106,  238,  230,  114,   94,
+     231,  125,  254,  231,  130,   94,  232,  140,
+      14,  233,  148,  190,  233,  155,  190,  233,
+     155,   62,  234,  170,  174,  234,  170,  174,
+     234,  178,   46,  235,  182,  158,  235,  193,
+      30,  236,  193,  142,  236,  200,  142,  236,
+     208,  142,  237,  216,  142,  237,  216,  254,
+     237,  231,  126,  238,  233,  206,  238,  238,
+     238,  238,  238,  110,  239,  246,  110,  239,
+     246,  110,  239,  253,  222,  239,  253,  222,
+     239,  253,  222,  239,  253,  222,  239,    5,
+      95,  240,    5,   95,  240,    5,   95,  240,
+       5,   95,  240,    5,   95,  240,    5,   95,
+     240,   12,  207,  240,   12,  207,  240,   12,
+     207,  240,   16,   79,  241,   20,   79,  241,
+      20,   79,  241,   20,   79,  241,   20,  191,
+     241,   27,  191,  241,   27,  191,  241,   27,
+     191,  241,   27,   63,  242,   35,   63,  242,
+      35,   63,  242,   42,  175,  242,   42,  175,
+     242,   50,   47,  243,   50,   47,  243,   50,
+     175,  243,   58,  175,  243,   65,   31,  244,
+      65,  159,  244,   73,  159,  244,   80,   15,
+     245,   84,  143,  245,   88,  143,  245,   88,
+     143,  245,   88,  207,  245,   95,  255,  245,
+      95,  255,  245,   95,  255,  245,   95,  255,
+     245,   95,  255,  245,   88,  143,  245,   88,
+     143,  245,   88,   15,  245,   80,   15,  245,
+      80,   15,  245,   76,  159,  244,   73,  159,
+     244,   73,  159,  244,   65,   31,  244,   65,
+      31,  244,   65,   31,  244,   58,  175,  243,
+      58,  175,  243,   58,  175,  243,   58,   47,
+     243,   50,   47,  243,   50,   47,  243,   50,
+     175,  242,   42,  175,  242,   42,  175,  242,
+      35,   63,  242,   35,  191,  241,   27,  191,
+     241,   20,   79,  241,   12,   95,  240,    5,
+      31,  240,  253,  110,  239,  246,  238,  238,
+     231,  254,  237,  223,  254,  237,  216,   14,
+     237,  200,  158,  235,  185,  158,  235,  178,
+     174,  234,  163,  190,  233,  148,   78,  233,
+     144,  206,  232,  133,  222,  231,  117,   94,
+     231,  110,  238,  230,  102,  254,  229,   87,
+      14,  229,   80,  142,  228,   72,   30,  228,
+      57,   46,  227,   42,  174,  226,   27,  190,
+     225,   19,  206,  224,    4,  222,  223,  245,
+     109,  222,  230,  253,  221,  215,  141,  220,
+     185,   29,  219,  155,  189,  217,  147,   77,
+     216,  117,  221,  214,   94,  125,  213,   83,
+     141,  212,   57,   29,  211,   26,   61,  209,
+       4,   13,  208,  245,  108,  206,  215,  124,
+     204,  184,   44,  202,  158,   60,  201,  124,
+     220,  198,   94,  108,  197,   64,  204,  195,
+      49,   44,  194,   18,  204,  191,  244,   91,
+     190,  225,  251,  188,  191,   11,  187,  154,
+     187,  184,  116,   11,  183,  101,  107,  181,
+      71,  155,  178,   18,   75,  175,  240,  218,
+     173,  191,  138,  170,  146,   74,  167,   93,
+     154,  165,   70,   26,  162,    2,  218,  157,
+     183,   25,  153,  141,  201,  150,   62,   25,
+     145,  220,  104,  139,  137,   88,  136,  107,
+     216,  132,   39,  152,  128,  228,  247,  123,
+     187,    7,  122,  108,  103,  116,   32,  183,
+     110,  167,   70,  106,  100,  246,   98,  242,
+     213,   92,  167,  165,   87,  114,  213,   83,
+     219,   36,   71,   53,   20,   64,  211,    3,
+      61,  166,  147,   55,   76,   99,   50,    8,
+     147,   46,  230,  178,   44,  166,  114,   40,
+     113,  162,   37,   83,  194,   35,   15,   18,
+      31,  210,  193,   27,  158,  161,   25,  135,
+     145,   22,   82,   65,   19,   37,   97,   17,
+      18,  241,   15,  240,  144,   13,  210,   48,
+      12,  180,    0,   11,  172,  208,    9,  150,
+     240,    7,  119,    0,    7,  108,   16,    6,
+      89,   32,    5,   74,   48,    4,   59,  176,
+       3,   51,   48,    3,   44,  192,    2,   44,
+      64,    2,   36,   64,    2,   36,  208,    1,
+      29,  208,    1,   29,  144,    1,   21,   80,
+       1,   21,   80,    1,   21,  224,    0,   14,
+     224,    0,   14,  224,    0,   14,  224,    0,
+      14,  224,    0,   14,  224,    0,   14,  224,
+       0,   14,   80,    1,   21,   80,    1,   21,
+      80,    1,   21,  208,    1,   29,  208,    1,
+      29,   64,    2,   36,  192,    2,   44,   48,
+       3,   51,   48,    3,   59,   48,    4,   74,
+      32,    5,   89,  144,    5,   97,  128,    6,
+     112,  112,    7,  127,   96,    8,  138,   96,
+       9,  157,  192,   10,  187,  160,   12,  210,
+      96,   13,  225,    0,   15,  255,   96,   17,
+      37,  177,   19,   63,  177,   20,  105,  241,
+      23,  158,  177,   28,    0,   50,   32,   52,
+      18,   39,  196,   50,   53,  234,   19,   88,
+     137,   85,  100,  175,   54,  111,   47,  183,
+     119,  175,  151,  123,  228,   23,  129,   54,
+      72,  133,  122,   24,  137,  152,  120,  138,
+     190,  200,  141,  235,  168,  143,    2,  105,
+     144,   17,  153,  145,   40,  249,  146,   55,
+     233,  147,   62,  233,  147,   70,  105,  148,
+      70,  153,  148,   75,  217,  148,   78,  233,
+     148,   80,    9,  149,   81,   25,  149,   81,
+      41,  149,   83,   73,  149,   84,   73,  149,
+      84,   73,  149,   84,   73,  149,   84,   73,
+     149,   83,   57,  149,   82,   25,  149,   80,
+     249,  148,   79,  217,  148,   76,  201,  148,
+      75,  169,  148,   73,  137,  148,   71,  105,
+     148,   68,   41,  148,   63,  217,  147,   62,
+     121,  147,   55,  249,  146,   40,  137,  146,
+      32,  153,  145,   17,  217,  144,    9,   41,
+     144,  243,  184,  142,  220,  216,  140,  201,
+     104,  140,  182,  120,  138,  160,   24,  137,
+     130,  168,  135,  107,  200,  133,   69,  248,
+     130,   24,  184,  127,  247,  215,  125,  200,
+     135,  122,  203,  130,   39,   60,  194,   35,
+      15,  146,   30,  195,   81,   26,  142,  129,
+      23,  120,  145,   22,   90,  177,   20,   59,
+      65,   19,   37,   17,   18,   22,  225,   16,
+       7,  241,   15,  248,    0,   15,  236,  128,
+      14,  225,  144,   13,  210,  160,   12,  202,
+     112,   12,  195,  176,   11,  187,   64,   11,
+     172,  192,   10,  168,   80,   10,  165,  208,
+       9,  157,   96,    9,  150,   96,    9,  150,
+     224,    8,  142,  224,    8,  142,  224,    8,
+     142,   96,    8,  134,   96,    8,  134,   96,
+       8,  134,   96,    8,  134,   96,    8,  134,
+      96,    8,  142,  224,    8,  142,  224,    8,
+     142,  224,    8,  142,   96,    9,  150,   96,
+       9,  150,  208,    9,  157,  208,    9,  157,
+      80,   10,  165,   80,   10,  165,   80,   10,
+     172,  192,   10,  180,   64,   11,  180,  176,
+      11,  187,   48,   12,  195,  160,   12,  202,
+     160,   12,  210,  144,   13,  217,   16,   14,
+     232,  192,   14,  248,  128,   15,    7,  225,
+      16,   22,   81,   18,   37,  193,   18,   52,
+      49,   20,   82,  161,   21,   93,  145,   22,
+     120,  225,   24,  173,   49,   28,  225,   81,
+      30,    7,  210,   34,   83,   18,   39,  158,
+      66,   44,  199,   34,   46,   15,   83,   51,
+      83,  147,   55,  143,  115,   57,  174,  195,
+      60,  234,  131,   64,   38,   68,   68,   72,
+     180,   69,  121,  116,   73,  182,  180,   77,
+       9,  197,   80,   46,  197,   85,  129,  245,
+      89,  190,  197,   93,  220,   37,   95,    9,
+       6,   98,   47,   86,  100,   84,   70,  101,
+      92,  182,  102,  122,   38,  104,  145,    6,
+     106,  160,  246,  106,  183,  102,  108,  205,
+      86,  109,  220,    6,  110,  235,   54,  111,
+     250,   38,  112,    2,  167,  112,   13,   23,
+     113,   25,  151,  113,   32,  135,  114,   47,
+     247,  114,   55,  231,  115,   62,  103,  116,
+      77,  215,  116,   81,   87,  117,   92,   71,
+     118,  108,  199,  118,  115,   55,  119,  115,
+      55,  119,  123,  231,  119,  130,  103,  120,
+     137,  199,  120,  143,   23,  121,  149,  135,
+     121,  155,  231,  121,  160,   39,  122,  164,
+     119,  122,  170,  215,  122,  176,   39,  123,
+     180,  103,  123,  184,  151,  123,  187,  199,
+     123,  190,    7,  124,  194,   71,  124,  197,
+     119,  124,  201,  183,  124,  205,  247,  124,
+     209,   39,  125,  212,  103,  125,  217,  183,
+     125,  221,  247,  125,  224,   23,  126,  228,
+      87,  126,  231,  151,  126,  235,  215,  126,
+     239,    7,  127,  242,   55,  127,  244,   87,
+     127,  247,  119,  127,  249,  167,  127,  251,
+     199,  127,  253,  231,  127,  255,   55,  128,
+       0,
+};
+
+const int16_t wavetable_7_base[128] PROGMEM = {
+       51,   131,   192,   249,   312,   372,   419,   455,
+      497,   546,   587,   635,   678,   711,   750,   798,
+      840,   878,   921,   967,  1013,  1054,  1093,  1145,
+     1195,  1241,  1282,  1323,  1364,  1400,  1440,  1485,
+     1528,  1565,  1598,  1630,  1662,  1704,  1742,  1772,
+     1796,  1821,  1847,  1870,  1889,  1900,  1909,  1900,
+     1870,  1840,  1794,  1734,  1658,  1587,  1500,  1357,
+     1142,   942,   780,   568,   356,   131,   -65,  -226,
+     -389,  -577,  -747,  -879,  -981, -1098, -1218, -1327,
+    -1418, -1488, -1558, -1618, -1663, -1701, -1750, -1792,
+    -1826, -1866, -1878, -1885, -1886, -1883, -1875, -1856,
+    -1824, -1797, -1776, -1763, -1753, -1744, -1737, -1729,
+    -1722, -1716, -1710, -1705, -1698, -1691, -1680, -1659,
+    -1628, -1598, -1574, -1536, -1495, -1453, -1419, -1374,
+    -1287, -1102,  -887,  -722,  -578,  -465,  -390,  -322,
+     -265,  -208,  -163,  -164,   -88,   -61,   -37,   -12,
+};
+const int8_t wavetable_7_ofs[1024] PROGMEM = {
+     -40,   -9,   -4,    0,    5,   18,   29,   40,
+     -29,  -19,   -8,   -1,    7,   14,   21,   28,
+     -26,  -18,  -11,   -4,    3,   10,   18,   25,
+     -25,  -18,  -11,   -3,    4,   11,   18,   25,
+     -30,  -23,  -15,   -8,    0,   15,   22,   30,
+     -23,  -17,  -12,   -7,    8,   15,   19,   23,
+     -17,   -9,   -5,   -2,    6,   10,   13,   17,
+     -15,   -7,   -4,    0,    8,   10,   13,   15,
+     -19,  -15,  -12,   -4,    3,    7,   11,   18,
+     -23,  -23,  -15,   -8,   -4,    0,   15,   22,
+     -19,  -11,   -4,    0,    4,   11,   15,   19,
+     -21,  -14,  -10,   -6,    1,    9,   16,   20,
+     -19,  -15,  -12,   -4,    0,    3,   11,   18,
+     -12,   -9,   -7,   -7,    1,    4,    8,   12,
+     -23,   -8,   -1,    3,    7,   14,   18,   22,
+     -19,  -11,   -3,    4,    7,    9,   12,   19,
+     -19,  -15,   -8,   -3,    2,    7,   15,   19,
+     -16,  -12,   -8,   -4,    0,    3,    7,   15,
+     -21,  -13,  -11,   -8,   -6,    9,   17,   21,
+     -22,  -18,  -14,   -6,    1,    9,   16,   21,
+     -20,  -15,   -7,   -3,    0,   15,   18,   20,
+     -18,  -11,   -3,    5,    8,   12,   15,   17,
+     -19,   -4,    0,    3,   11,   13,   16,   18,
+     -19,  -15,  -11,   -7,   -3,   12,   15,   19,
+     -23,  -16,  -11,   -6,   -1,    7,   14,   22,
+     -16,  -13,   -9,   -1,    2,    6,   14,   16,
+     -22,  -20,   -5,    3,    7,   10,   18,   22,
+     -15,   -8,   -4,    0,    0,    7,   11,   15,
+     -19,  -11,  -11,   -4,    4,    8,   11,   19,
+     -17,  -10,   -2,    6,    6,    6,   13,   17,
+     -19,  -12,   -4,    0,    3,    7,   11,   18,
+     -19,  -12,   -9,   -7,   -4,   11,   15,   19,
+     -17,  -13,   -9,   -6,   -2,    6,   13,   16,
+     -19,  -16,   -9,   -1,    3,    7,   14,   18,
+     -11,   -8,   -4,    4,    4,    4,    7,   11,
+     -13,   -9,   -6,    2,    2,    6,    9,   13,
+     -15,  -15,   -8,    0,    4,    8,   15,   15,
+     -19,  -12,   -4,    0,    3,   11,   11,   18,
+     -12,  -12,   -8,   -5,    3,    3,   11,   11,
+     -12,   -8,   -4,   -4,    3,    3,   11,   11,
+      -9,   -6,   -6,    2,    2,    2,    9,    9,
+     -16,   -8,   -8,   -1,    7,    7,   11,   15,
+     -11,   -4,   -4,   -4,    4,    4,    4,   11,
+     -12,   -4,   -4,    3,    3,    3,    3,   11,
+      -8,   -1,   -1,   -1,   -1,   -1,    7,    7,
+      -4,   -4,   -4,   -4,    3,    3,    3,    3,
+      -2,    2,    2,    2,    2,    2,    2,    2,
+      11,    3,    3,    3,   -4,   -4,   -8,  -12,
+      11,   11,    3,   -4,   -4,   -8,  -12,  -12,
+      11,   11,    3,    3,   -1,   -4,  -12,  -12,
+      26,   19,   11,    8,    4,   -4,  -11,  -26,
+      26,   19,   19,   11,    3,  -12,  -19,  -27,
+      34,   30,   19,   12,   -4,  -11,  -19,  -34,
+      34,   30,   22,    7,    0,  -15,  -31,  -34,
+      49,   34,   26,   11,  -11,  -34,  -38,  -49,
+      71,   49,   26,    3,  -19,  -23,  -49,  -72,
+      98,   60,   30,    0,   -8,  -46,  -76,  -99,
+      71,   49,   11,    7,  -12,  -34,  -49,  -72,
+      67,   52,   45,   30,    7,  -16,  -38,  -68,
+     113,  110,   91,   61,   23,  -37,  -75, -113,
+      92,   69,   39,   16,  -22,  -59,  -89,  -93,
+      98,   68,   37,    0,  -30,  -61,  -68,  -98,
+      67,   38,   16,   -7,  -22,  -26,  -45,  -67,
+      71,   56,   33,    3,   -1,  -27,  -50,  -72,
+      68,   46,   15,   12,   -7,  -30,  -53,  -68,
+      98,   94,   68,   30,    0,  -31,  -61,  -98,
+      72,   41,   19,   -4,  -19,  -42,  -72,  -72,
+      45,   30,    7,   -8,  -23,  -30,  -34,  -45,
+      49,   34,   19,    4,  -11,  -15,  -26,  -49,
+      53,   38,   23,    0,    0,  -15,  -38,  -53,
+      52,   37,    7,    7,   -8,  -23,  -38,  -53,
+      41,   25,   22,   10,   -5,  -20,  -27,  -42,
+      34,   34,   26,   11,    3,  -12,  -27,  -34,
+      36,   21,   13,   -2,  -17,  -25,  -32,  -36,
+      30,   23,    8,    0,  -15,  -15,  -19,  -30,
+      22,   15,    7,    0,   -8,  -12,  -15,  -23,
+      15,    7,   -1,   -1,   -4,   -8,  -16,  -16,
+      15,    7,    7,    3,    0,   -8,   -8,  -15,
+      19,   11,   11,   11,    3,   -4,  -12,  -19,
+      15,   15,   15,    8,    0,   -7,  -15,  -15,
+      15,   12,    4,   -4,   -4,  -11,  -11,  -15,
+       7,    6,    4,    3,    0,   -2,   -4,   -7,
+       4,    3,    2,    0,   -2,   -2,   -4,   -5,
+       1,    1,    0,   -1,   -1,   -1,   -2,   -2,
+      -1,   -1,   -1,   -1,   -1,   -1,   -1,    0,
+      -3,   -3,   -3,   -2,   -2,    0,    1,    2,
+      -5,   -4,   -3,   -1,    0,    2,    4,    5,
+     -11,   -8,   -6,   -3,   -2,    4,    8,   10,
+     -15,  -12,  -10,   -2,    1,    5,   12,   14,
+     -12,   -5,   -2,    1,    3,    6,    9,   12,
+      -7,   -5,   -2,    0,    1,    3,    5,    6,
+      -5,   -3,   -2,   -1,    0,    3,    3,    4,
+      -5,   -3,   -1,   -1,    0,    2,    3,    4,
+      -4,   -2,   -1,   -1,    0,    1,    2,    3,
+      -3,   -2,    0,    0,    1,    3,    3,    3,
+      -3,   -3,   -1,   -1,    0,    1,    2,    3,
+      -4,   -3,   -1,    0,    0,    1,    2,    3,
+      -3,   -2,   -1,   -1,    1,    1,    2,    2,
+      -3,   -2,   -2,   -1,   -1,    1,    1,    2,
+      -3,   -2,   -1,    0,    0,    1,    2,    2,
+      -3,   -3,   -2,   -1,    0,    0,    1,    2,
+      -5,   -4,   -2,   -1,    0,    1,    3,    4,
+      -7,   -4,   -2,   -2,    1,    3,    4,    7,
+     -12,   -9,   -6,   -2,    0,    3,    5,   12,
+     -16,  -11,   -3,   -1,    4,   10,   15,   16,
+     -10,   -8,   -6,   -6,   -6,   -3,    1,    9,
+     -15,   -8,    0,    0,    4,    7,    7,   15,
+     -16,   -8,   -8,   -4,    0,    7,   15,   15,
+     -19,  -11,  -11,   -4,   -4,    4,   11,   19,
+     -16,  -16,  -16,   -8,    0,    7,    7,   15,
+     -19,  -12,   -4,    3,   11,   18,   18,   18,
+     -19,  -19,  -12,   -4,    4,    7,   11,   19,
+     -68,  -61,  -61,  -68,   -8,    7,   30,   67,
+     -95,  -65,  -61,  -27,    3,   41,   63,   94,
+     -91,  -87,  -53,  -31,   -1,   37,   67,   90,
+     -68,  -45,  -22,   -7,   15,   38,   68,   68,
+     -61,  -38,  -16,    7,   22,   45,   45,   60,
+     -38,  -23,   -8,    0,   15,   19,   22,   37,
+     -30,  -15,   -7,    0,    4,   15,   23,   30,
+     -30,  -15,  -15,  -11,    0,    8,   23,   30,
+     -19,  -12,  -12,   -4,    3,   11,   18,   18,
+     -23,  -23,  -23,   -8,   -1,   14,   14,   22,
+     -19,  -16,   -8,   -1,    7,   15,   15,   18,
+      23,   31,   38,   42,   46,  -62,   57,   61,
+     -11,   -8,   -4,    0,    2,    5,    7,   11,
+     -12,   -8,   -4,   -2,    1,    3,    7,   11,
+     -10,   -6,   -4,   -2,    0,    2,    5,    9,
+     -13,  -11,   -8,   -6,   -3,   -1,   12,   12,
+};
+
+const int16_t wavetable_sine1024_q[257] PROGMEM = {
+        0,    12,    25,    37,    50,    62,    75,    87,
+      100,   113,   125,   138,   150,   163,   175,   188,
+      200,   213,   225,   238,   250,   263,   275,   288,
+      300,   312,   325,   337,   350,   362,   374,   387,
+      399,   411,   424,   436,   448,   460,   473,   485,
+      497,   509,   521,   534,   546,   558,   570,   582,
+      594,   606,   618,   630,   642,   654,   666,   678,
+      689,   701,   713,   725,   737,   748,   760,   772,
+      783,   795,   806,   818,   829,   841,   852,   864,
+      875,   886,   898,   909,   920,   932,   943,   954,
+      965,   976,   987,   998,  1009,  1020,  1031,  1042,
+     1052,  1063,  1074,  1085,  1095,  1106,  1116,  1127,
+     1137,  1148,  1158,  1168,  1179,  1189,  1199,  1209,
+     1219,  1230,  1240,  1250,  1259,  1269,  1279,  1289,
+     1299,  1308,  1318,  1328,  1337,  1347,  1356,  1366,
+     1375,  1384,  1393,  1403,  1412,  1421,  1430,  1439,
+     1448,  1457,  1465,  1474,  1483,  1491,  1500,  1509,
+     1517,  1525,  1534,  1542,  1550,  1558,  1567,  1575,
+     1583,  1591,  1598,  1606,  1614,  1622,  1629,  1637,
+     1644,  1652,  1659,  1667,  1674,  1681,  1688,  1695,
+     1702,  1709,  1716,  1723,  1730,  1736,  1743,  1750,
+     1756,  1763,  1769,  1775,  1781,  1788,  1794,  1800,
+     1806,  1812,  1817,  1823,  1829,  1834,  1840,  1845,
+     1851,  1856,  1861,  1867,  1872,  1877,  1882,  1887,
+     1892,  1896,  1901,  1906,  1910,  1915,  1919,  1924,
+     1928,  1932,  1936,  1940,  1944,  1948,  1952,  1956,
+     1959,  1963,  1966,  1970,  1973,  1977,  1980,  1983,
+     1986,  1989,  1992,  1995,  1998,  2000,  2003,  2006,
+     2008,  2011,  2013,  2015,  2017,  2019,  2021,  2023,
+     2025,  2027,  2029,  2031,  2032,  2034,  2035,  2036,
+     2038,  2039,  2040,  2041,  2042,  2043,  2044,  2044,
+     2045,  2046,  2046,  2047,  2047,  2047,  2047,  2047,
+     2048,
+};
+
+const int16_t wavetable_triangle_q[257] PROGMEM = {
+        0,     8,    16,    24,    32,    39,    47,    55,
+       63,    71,    79,    87,    95,   103,   112,   120,
+      128,   136,   144,   153,   161,   169,   178,   186,
+      195,   203,   211,   220,   228,   237,   246,   254,
+      263,   271,   280,   288,   297,   305,   314,   322,
+      331,   339,   347,   356,   364,   372,   381,   389,
+      397,   405,   414,   422,   430,   438,   446,   454,
+      462,   470,   478,   486,   493,   501,   509,   517,
+      525,   533,   541,   548,   556,   564,   572,   580,
+      588,   596,   604,   612,   620,   628,   636,   644,
+      653,   661,   669,   677,   686,   694,   703,   711,
+      719,   728,   736,   745,   754,   762,   771,   779,
+      788,   796,   805,   814,   822,   831,   839,   848,
+      856,   865,   873,   882,   890,   898,   907,   915,
+      923,   931,   939,   947,   955,   963,   971,   979,
+      987,   995,  1003,  1011,  1018,  1026,  1034,  1042,
+     1050,  1057,  1065,  1073,  1081,  1088,  1096,  1104,
+     1112,  1120,  1128,  1136,  1144,  1152,  1160,  1168,
+     1176,  1185,  1193,  1201,  1210,  1218,  1227,  1235,
+     1244,  1252,  1261,  1270,  1279,  1287,  1296,  1305,
+     1314,  1322,  1331,  1340,  1349,  1357,  1366,  1375,
+     1383,  1392,  1400,  1409,  1417,  1426,  1434,  1442,
+     1450,  1458,  1466,  1474,  1482,  1490,  1498,  1506,
+     1513,  1521,  1528,  1536,  1543,  1551,  1558,  1566,
+     1573,  1580,  1588,  1595,  1603,  1610,  1618,  1625,
+     1633,  1640,  1648,  1656,  1664,  1672,  1680,  1688,
+     1697,  1705,  1714,  1722,  1731,  1740,  1749,  1758,
+     1767,  1777,  1786,  1796,  1805,  1815,  1824,  1834,
+     1844,  1853,  1863,  1873,  1882,  1892,  1901,  1911,
+     1920,  1929,  1938,  1946,  1955,  1963,  1971,  1978,
+     1986,  1993,  1999,  2006,  2011,  2017,  2022,  2027,
+     2031,  2035,  2038,  2041,  2043,  2045,  2046,  2047,
+     2047,
+};
+
+const int16_t wavetable_square_q[257] PROGMEM = {
+        0,   108,   216,   324,   430,   535,   638,   739,
+      838,   934,  1028,  1118,  1205,  1288,  1368,  1443,
+     1514,  1581,  1644,  1702,  1755,  1804,  1848,  1888,
+     1923,  1953,  1979,  2000,  2018,  2031,  2040,  2045,
+     2047,  2045,  2040,  2033,  2022,  2009,  1994,  1977,
+     1958,  1937,  1916,  1893,  1870,  1846,  1822,  1799,
+     1775,  1752,  1730,  1708,  1688,  1668,  1650,  1634,
+     1619,  1605,  1594,  1584,  1576,  1569,  1565,  1562,
+     1561,  1562,  1565,  1569,  1574,  1582,  1590,  1600,
+     1610,  1622,  1634,  1648,  1661,  1675,  1690,  1704,
+     1719,  1733,  1747,  1760,  1773,  1786,  1797,  1808,
+     1818,  1827,  1834,  1841,  1846,  1851,  1854,  1856,
+     1856,  1856,  1854,  1851,  1847,  1842,  1836,  1829,
+     1821,  1813,  1804,  1794,  1784,  1774,  1764,  1753,
+     1742,  1732,  1721,  1711,  1701,  1692,  1683,  1675,
+     1667,  1661,  1655,  1650,  1645,  1642,  1640,  1638,
+     1638,  1638,  1640,  1642,  1645,  1649,  1654,  1659,
+     1666,  1672,  1680,  1687,  1695,  1704,  1712,  1721,
+     1730,  1739,  1747,  1756,  1764,  1771,  1779,  1786,
+     1792,  1798,  1803,  1807,  1810,  1813,  1815,  1816,
+     1817,  1816,  1815,  1813,  1810,  1807,  1803,  1798,
+     1793,  1787,  1781,  1774,  1767,  1760,  1752,  1745,
+     1737,  1729,  1722,  1714,  1707,  1700,  1694,  1688,
+     1682,  1677,  1673,  1669,  1666,  1663,  1661,  1660,
+     1660,  1660,  1661,  1663,  1666,  1669,  1672,  1677,
+     1682,  1687,  1693,  1699,  1705,  1712,  1719,  1726,
+     1733,  1740,  1747,  1754,  1760,  1767,  1773,  1778,
+     1784,  1788,  1792,  1796,  1799,  1801,  1803,  1804,
+     1804,  1804,  1803,  1801,  1799,  1796,  1793,  1789,
+     1784,  1779,  1773,  1767,  1761,  1755,  1748,  1742,
+     1735,  1728,  1721,  1715,  1708,  1702,  1696,  1691,
+     1686,  1681,  1677,  1674,  1671,  1669,  1667,  1666,
+     1666,
+};
+
+const int16_t wavetable_clarinet_q[257] PROGMEM = {
+        0,   100,   200,   299,   397,   494,   590,   685,
+      777,   868,   957,  1043,  1126,  1207,  1284,  1358,
+     1429,  1497,  1561,  1621,  1677,  1730,  1778,  1823,
+     1863,  1899,  1932,  1960,  1984,  2004,  2020,  2032,
+     2041,  2046,  2047,  2045,  2039,  2031,  2019,  2004,
+     1987,  1967,  1945,  1921,  1894,  1866,  1837,  1806,
+     1774,  1740,  1707,  1672,  1637,  1602,  1567,  1532,
+     1497,  1463,  1430,  1397,  1365,  1334,  1305,  1276,
+     1249,  1223,  1199,  1177,  1156,  1137,  1119,  1103,
+     1089,  1077,  1066,  1057,  1050,  1044,  1041,  1038,
+     1037,  1038,  1039,  1042,  1047,  1052,  1058,  1065,
+     1073,  1082,  1092,  1101,  1112,  1122,  1133,  1144,
+     1155,  1166,  1177,  1187,  1198,  1208,  1217,  1226,
+     1235,  1242,  1250,  1256,  1262,  1267,  1271,  1275,
+     1277,  1279,  1280,  1280,  1280,  1278,  1276,  1273,
+     1269,  1265,  1260,  1254,  1248,  1241,  1234,  1226,
+     1217,  1208,  1199,  1190,  1180,  1170,  1159,  1148,
+     1138,  1126,  1115,  1104,  1092,  1081,  1069,  1057,
+     1045,  1033,  1021,  1009,   997,   984,   972,   959,
+      947,   934,   921,   907,   894,   880,   866,   852,
+      837,   822,   807,   791,   775,   759,   742,   725,
+      708,   690,   672,   653,   634,   615,   596,   576,
+      556,   536,   515,   495,   474,   454,   434,   413,
+      393,   373,   354,   334,   316,   297,   280,   263,
+      247,   232,   218,   205,   192,   182,   172,   164,
+      157,   151,   147,   145,   144,   145,   148,   152,
+      158,   166,   175,   187,   200,   215,   231,   250,
+      269,   291,   314,   338,   364,   392,   420,   450,
+      481,   512,   545,   578,   612,   646,   680,   715,
+      750,   785,   820,   854,   888,   921,   953,   985,
+     1015,  1045,  1073,  1100,  1125,  1149,  1171,  1191,
+     1209,  1226,  1240,  1252,  1262,  1270,  1276,  1279,
+     1280,
+};
+
+const int16_t wavetable_hollow_q[257] PROGMEM = {
+        0,    42,    84,   125,   167,   208,   250,   291,
+      332,   374,   414,   455,   496,   536,   576,   616,
+      655,   694,   733,   772,   810,   848,   885,   922,
+      959,   995,  1031,  1066,  1101,  1136,  1169,  1203,
+     1236,  1268,  1300,  1331,  1361,  1391,  1421,  1450,
+     1478,  1505,  1532,  1558,  1584,  1609,  1633,  1657,
+     1680,  1702,  1724,  1745,  1765,  1784,  1803,  1821,
+     1839,  1855,  1871,  1887,  1901,  1915,  1928,  1941,
+     1952,  1963,  1974,  1983,  1992,  2000,  2008,  2015,
+     2021,  2026,  2031,  2035,  2039,  2042,  2044,  2046,
+     2047,  2047,  2047,  2046,  2045,  2043,  2040,  2037,
+     2034,  2029,  2025,  2020,  2014,  2008,  2001,  1994,
+     1987,  1979,  1971,  1962,  1953,  1944,  1934,  1924,
+     1913,  1903,  1892,  1880,  1869,  1857,  1845,  1833,
+     1820,  1807,  1795,  1782,  1768,  1755,  1742,  1728,
+     1715,  1701,  1687,  1673,  1660,  1646,  1632,  1618,
+     1604,  1591,  1577,  1563,  1550,  1536,  1523,  1509,
+     1496,  1483,  1470,  1458,  1445,  1433,  1420,  1408,
+     1397,  1385,  1374,  1362,  1352,  1341,  1330,  1320,
+     1310,  1301,  1291,  1282,  1273,  1265,  1257,  1249,
+     1241,  1234,  1227,  1220,  1214,  1208,  1202,  1196,
+     1191,  1186,  1182,  1178,  1174,  1170,  1167,  1164,
+     1161,  1159,  1157,  1155,  1153,  1152,  1151,  1150,
+     1150,  1150,  1150,  1150,  1151,  1152,  1153,  1154,
+     1156,  1158,  1160,  1162,  1164,  1167,  1170,  1173,
+     1176,  1179,  1182,  1186,  1190,  1194,  1197,  1202,
+     1206,  1210,  1214,  1219,  1223,  1227,  1232,  1236,
+     1241,  1246,  1250,  1255,  1260,  1264,  1269,  1273,
+     1278,  1282,  1287,  1291,  1295,  1299,  1303,  1307,
+     1311,  1315,  1319,  1322,  1326,  1329,  1332,  1335,
+     1338,  1341,  1343,  1346,  1348,  1350,  1352,  1354,
+     1355,  1357,  1358,  1359,  1360,  1360,  1361,  1361,
+     1361,
+};
+
+const int16_t wavetable_flute_q[257] PROGMEM = {
+        0,    20,    39,    59,    78,    98,   117,   137,
+      156,   176,   195,   215,   234,   253,   272,   292,
+      311,   330,   349,   368,   387,   405,   424,   443,
+      461,   480,   498,   517,   535,   553,   571,   589,
+      607,   624,   642,   659,   677,   694,   711,   728,
+      745,   762,   778,   795,   811,   827,   843,   859,
+      875,   890,   906,   921,   936,   951,   966,   981,
+      996,  1010,  1024,  1038,  1052,  1066,  1080,  1093,
+     1107,  1120,  1133,  1146,  1158,  1171,  1183,  1196,
+     1208,  1220,  1231,  1243,  1254,  1266,  1277,  1288,
+     1299,  1309,  1320,  1330,  1340,  1350,  1360,  1370,
+     1380,  1389,  1398,  1408,  1417,  1426,  1434,  1443,
+     1452,  1460,  1468,  1476,  1484,  1492,  1500,  1508,
+     1515,  1523,  1530,  1537,  1544,  1551,  1558,  1565,
+     1571,  1578,  1584,  1591,  1597,  1603,  1609,  1615,
+     1621,  1627,  1633,  1638,  1644,  1649,  1655,  1660,
+     1665,  1671,  1676,  1681,  1686,  1691,  1696,  1701,
+     1705,  1710,  1715,  1719,  1724,  1729,  1733,  1738,
+     1742,  1746,  1751,  1755,  1759,  1764,  1768,  1772,
+     1776,  1780,  1784,  1788,  1792,  1796,  1800,  1804,
+     1808,  1812,  1816,  1820,  1824,  1828,  1831,  1835,
+     1839,  1843,  1847,  1850,  1854,  1858,  1861,  1865,
+     1869,  1872,  1876,  1879,  1883,  1886,  1890,  1893,
+     1897,  1900,  1904,  1907,  1911,  1914,  1917,  1921,
+     1924,  1927,  1931,  1934,  1937,  1940,  1943,  1946,
+     1950,  1953,  1956,  1959,  1962,  1965,  1967,  1970,
+     1973,  1976,  1979,  1981,  1984,  1987,  1989,  1992,
+     1994,  1997,  1999,  2001,  2004,  2006,  2008,  2010,
+     2012,  2014,  2016,  2018,  2020,  2022,  2024,  2026,
+     2027,  2029,  2030,  2032,  2033,  2034,  2036,  2037,
+     2038,  2039,  2040,  2041,  2042,  2043,  2043,  2044,
+     2045,  2045,  2046,  2046,  2046,  2047,  2047,  2047,
+     2047,
+};
+
+const int16_t wavetable_oboe_q[257] PROGMEM = {
+        0,    66,   132,   198,   264,   329,   394,   459,
+      523,   586,   649,   711,   772,   833,   892,   951,
+     1008,  1064,  1119,  1173,  1225,  1276,  1326,  1374,
+     1421,  1466,  1510,  1552,  1593,  1632,  1669,  1704,
+     1738,  1770,  1800,  1829,  1855,  1880,  1903,  1925,
+     1944,  1962,  1978,  1993,  2005,  2016,  2025,  2033,
+     2039,  2043,  2046,  2047,  2047,  2045,  2042,  2037,
+     2031,  2024,  2015,  2006,  1995,  1983,  1970,  1956,
+     1940,  1925,  1908,  1890,  1872,  1853,  1833,  1813,
+     1792,  1771,  1749,  1727,  1704,  1682,  1659,  1636,
+     1612,  1589,  1566,  1542,  1519,  1496,  1472,  1449,
+     1427,  1404,  1382,  1360,  1338,  1317,  1296,  1275,
+     1255,  1236,  1216,  1198,  1179,  1161,  1144,  1127,
+     1111,  1095,  1080,  1065,  1051,  1038,  1024,  1012,
+     1000,   988,   977,   966,   956,   946,   937,   928,
+      920,   912,   904,   896,   889,   883,   876,   870,
+      864,   859,   853,   848,   843,   838,   833,   829,
+      824,   820,   815,   811,   807,   802,   798,   794,
+      790,   785,   781,   776,   772,   767,   763,   758,
+      753,   748,   743,   738,   733,   727,   722,   716,
+      711,   705,   699,   693,   687,   681,   674,   668,
+      662,   655,   649,   642,   636,   629,   622,   616,
+      609,   603,   597,   590,   584,   578,   572,   566,
+      560,   554,   549,   543,   538,   533,   528,   524,
+      519,   515,   511,   507,   504,   500,   498,   495,
+      492,   490,   488,   487,   485,   484,   483,   483,
+      482,   482,   483,   483,   484,   485,   486,   487,
+      489,   491,   493,   495,   497,   500,   502,   505,
+      508,   511,   514,   517,   521,   524,   527,   531,
+      534,   537,   541,   544,   547,   550,   553,   556,
+      559,   562,   565,   567,   570,   572,   574,   576,
+      578,   579,   581,   582,   583,   584,   584,   584,
+      585,
+};
+
+const int16_t wavetable_bell_q[257] PROGMEM = {
+        0,    63,   125,   187,   249,   310,   369,   428,
+      485,   540,   594,   645,   695,   742,   787,   830,
+      870,   907,   941,   973,  1001,  1027,  1050,  1069,
+     1086,  1100,  1110,  1118,  1123,  1125,  1124,  1121,
+     1115,  1107,  1096,  1083,  1069,  1052,  1033,  1013,
+      992,   969,   945,   920,   895,   869,   842,   815,
+      788,   761,   735,   708,   682,   657,   633,   609,
+      587,   565,   545,   526,   508,   491,   476,   463,
+      451,   441,   432,   424,   418,   414,   411,   409,
+      408,   409,   411,   414,   419,   424,   430,   436,
+      444,   452,   460,   469,   478,   487,   495,   504,
+      513,   521,   529,   537,   544,   550,   556,   561,
+      565,   568,   570,   571,   571,   571,   569,   566,
+      562,   558,   552,   545,   538,   530,   521,   511,
+      501,   490,   478,   466,   454,   442,   429,   417,
+      404,   391,   379,   367,   356,   344,   334,   324,
+      315,   306,   299,   292,   286,   281,   277,   274,
+      272,   272,   272,   274,   276,   279,   284,   289,
+      296,   303,   311,   320,   329,   340,   350,   361,
+      373,   384,   396,   408,   420,   432,   444,   455,
+      466,   477,   487,   496,   505,   512,   519,   526,
+      531,   535,   538,   540,   541,   541,   540,   538,
+      534,   530,   525,   519,   512,   504,   495,   486,
+      476,   466,   456,   445,   434,   423,   412,   401,
+      391,   381,   372,   364,   357,   351,   345,   342,
+      339,   338,   339,   342,   346,   352,   361,   371,
+      384,   398,   415,   435,   456,   480,   506,   534,
+      564,   597,   632,   668,   707,   747,   789,   833,
+      878,   925,   972,  1021,  1070,  1120,  1171,  1222,
+     1273,  1323,  1374,  1424,  1473,  1522,  1569,  1615,
+     1660,  1703,  1744,  1783,  1820,  1855,  1887,  1916,
+     1943,  1967,  1988,  2006,  2021,  2032,  2040,  2045,
+     2047,
+};
+
+const wavetable_compressed_t wavetables[] = {
+    { WAVETABLE_FORMAT_BLOCK8, wavetable_0_base, wavetable_0_ofs },
+    { WAVETABLE_FORMAT_BLOCK8, wavetable_1_base, wavetable_1_ofs },
+    { WAVETABLE_FORMAT_PACKED12, wavetable_2_p12, NULL },
+    { WAVETABLE_FORMAT_BLOCK8, wavetable_3_base, wavetable_3_ofs },
+    { WAVETABLE_FORMAT_PACKED12, wavetable_4_p12, NULL },
+    { WAVETABLE_FORMAT_BLOCK8, wavetable_5_base, wavetable_5_ofs },
+    { WAVETABLE_FORMAT_PACKED12, wavetable_6_p12, NULL },
+    { WAVETABLE_FORMAT_BLOCK8, wavetable_7_base, wavetable_7_ofs },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_sine1024_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_triangle_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_square_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_clarinet_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_hollow_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_flute_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_oboe_q, NULL },
+    { WAVETABLE_FORMAT_QUARTER, wavetable_bell_q, NULL },
+};
+
+#endif // WAVETABLE_COMPRESSED_H
@@ -0,0 +1,439 @@
+/* Theremin WAVE Table mip-maps - generated by scripts/gen_wavetable_mipmaps.py, do not edit.
+ *
+ * level L: 128/64/32/16/8 samples, harmonics 1..(512 >> L) - 1, played for increments <= 64 << L
+ * levels 0..2 reuse the full 1024-point table.
+ *
+ * FLASH BUDGET (ATmega328P, 32256 bytes available to the sketch)
+ *   full 1024-point tables       8 x 2048 = 16384 bytes
+ *   mip-map levels 3..7          8 x  496 =  3968 bytes (+496 with WAVEFORM_INCLUDE_PURE_SINE)
+ *   mip-map pointer table        8 x   10 =    80 bytes
+ *   a full chain down from 512 points would instead cost 8 x 2032 = 16256 bytes,
+ *   which does not fit next to the full tables and the firmware.
+ */
+
+#ifndef WAVETABLE_MIPMAPS_H
+#define WAVETABLE_MIPMAPS_H
+
+#include <avr/pgmspace.h>
+
+#define WAVETABLE_MIPMAP_FIRST_LEVEL 3
+#define WAVETABLE_MIPMAP_LAST_LEVEL  7
+#define WAVETABLE_MIPMAP_LEVELS      5
+
+#ifdef WAVEFORM_INCLUDE_PURE_SINE
+const int16_t wavetable_sine1024_mip3[128] PROGMEM = {
+        0,   100,   200,   300,   399,   497,   594,   689,
+      783,   875,   965,  1052,  1137,  1219,  1299,  1375,
+     1448,  1517,  1583,  1644,  1702,  1756,  1806,  1851,
+     1892,  1928,  1959,  1986,  2008,  2025,  2038,  2045,
+     2047,  2045,  2038,  2025,  2008,  1986,  1959,  1928,
+     1892,  1851,  1806,  1756,  1702,  1644,  1583,  1517,
+     1448,  1375,  1299,  1219,  1137,  1052,   965,   875,
+      783,   689,   594,   497,   399,   300,   200,   100,
+        0,  -100,  -200,  -300,  -399,  -497,  -594,  -689,
+     -783,  -875,  -965, -1052, -1137, -1219, -1299, -1375,
+    -1448, -1517, -1583, -1644, -1702, -1756, -1806, -1851,
+    -1892, -1928, -1959, -1986, -2008, -2025, -2038, -2045,
+    -2047, -2045, -2038, -2025, -2008, -1986, -1959, -1928,
+    -1892, -1851, -1806, -1756, -1702, -1644, -1583, -1517,
+    -1448, -1375, -1299, -1219, -1137, -1052,  -965,  -875,
+     -783,  -689,  -594,  -497,  -399,  -300,  -200,  -100,
+};
+const int16_t wavetable_sine1024_mip4[64] PROGMEM = {
+        0,   200,   399,   594,   783,   965,  1137,  1299,
+     1448,  1583,  1702,  1806,  1892,  1959,  2008,  2038,
+     2047,  2038,  2008,  1959,  1892,  1806,  1702,  1583,
+     1448,  1299,  1137,   965,   783,   594,   399,   200,
+        0,  -200,  -399,  -594,  -783,  -965, -1137, -1299,
+    -1448, -1583, -1702, -1806, -1892, -1959, -2008, -2038,
+    -2048, -2038, -2008, -1959, -1892, -1806, -1702, -1583,
+    -1448, -1299, -1137,  -965,  -783,  -594,  -399,  -200,
+};
+const int16_t wavetable_sine1024_mip5[32] PROGMEM = {
+        0,   399,   783,  1137,  1448,  1702,  1892,  2008,
+     2047,  2008,  1892,  1702,  1448,  1137,   783,   399,
+        0,  -399,  -783, -1137, -1448, -1702, -1892, -2008,
+    -2048, -2008, -1892, -1702, -1448, -1137,  -783,  -399,
+};
+const int16_t wavetable_sine1024_mip6[16] PROGMEM = {
+        0,   783,  1448,  1892,  2047,  1892,  1448,   783,
+        0,  -783, -1448, -1892, -2048, -1892, -1448,  -783,
+};
+const int16_t wavetable_sine1024_mip7[8] PROGMEM = {
+        0,  1448,  2047,  1448,     0, -1448, -2048, -1448,
+};
+
+const int16_t *const wavetable_sine1024_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_sine1024_mip3, wavetable_sine1024_mip4, wavetable_sine1024_mip5, wavetable_sine1024_mip6, wavetable_sine1024_mip7
+};
+#endif // WAVEFORM_INCLUDE_PURE_SINE
+
+const int16_t wavetable_0_mip3[128] PROGMEM = {
+       -1,   115,   230,   345,   457,   568,   676,   783,
+      885,   985,  1081,  1174,  1263,  1347,  1427,  1502,
+     1572,  1638,  1699,  1755,  1806,  1852,  1893,  1929,
+     1960,  1986,  2007,  2024,  2036,  2043,  2046,  2045,
+     2040,  2030,  2018,  2001,  1980,  1957,  1930,  1901,
+     1868,  1832,  1794,  1753,  1709,  1664,  1616,  1566,
+     1513,  1459,  1403,  1345,  1285,  1223,  1159,  1094,
+     1027,   958,   887,   815,   741,   666,   589,   510,
+      430,   349,   266,   182,    96,    10,   -77,  -165,
+     -253,  -343,  -432,  -522,  -611,  -700,  -789,  -876,
+     -963, -1049, -1133, -1215, -1295, -1372, -1447, -1519,
+    -1587, -1651, -1712, -1769, -1821, -1867, -1910, -1946,
+    -1978, -2003, -2023, -2036, -2044, -2045, -2039, -2028,
+    -2009, -1984, -1953, -1914, -1870, -1820, -1763, -1700,
+    -1632, -1558, -1479, -1394, -1306, -1212, -1115, -1014,
+     -909,  -802,  -692,  -580,  -466,  -350,  -235,  -118,
+};
+const int16_t wavetable_0_mip4[64] PROGMEM = {
+       -1,   230,   457,   677,   886,  1081,  1263,  1427,
+     1572,  1699,  1806,  1893,  1960,  2007,  2036,  2046,
+     2040,  2018,  1981,  1930,  1868,  1794,  1709,  1616,
+     1514,  1403,  1285,  1159,  1027,   887,   741,   589,
+      430,   266,    96,   -77,  -253,  -432,  -611,  -789,
+     -963, -1133, -1295, -1447, -1587, -1712, -1821, -1910,
+    -1978, -2023, -2044, -2039, -2009, -1952, -1870, -1763,
+    -1632, -1479, -1306, -1115,  -909,  -692,  -466,  -234,
+};
+const int16_t wavetable_0_mip5[32] PROGMEM = {
+       -1,   457,   885,  1262,  1572,  1806,  1960,  2036,
+     2040,  1981,  1868,  1709,  1514,  1285,  1027,   741,
+      430,    96,  -253,  -611,  -963, -1295, -1587, -1820,
+    -1978, -2044, -2009, -1870, -1632, -1306,  -909,  -466,
+};
+const int16_t wavetable_0_mip6[16] PROGMEM = {
+       -1,   886,  1572,  1960,  2040,  1868,  1514,  1027,
+      430,  -253,  -963, -1587, -1978, -2009, -1632,  -909,
+};
+const int16_t wavetable_0_mip7[8] PROGMEM = {
+       -1,  1572,  2040,  1514,   430,  -963, -1978, -1632,
+};
+
+const int16_t *const wavetable_0_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_0_mip3, wavetable_0_mip4, wavetable_0_mip5, wavetable_0_mip6, wavetable_0_mip7
+};
+
+const int16_t wavetable_1_mip3[128] PROGMEM = {
+       -1,    15,    30,    45,    62,    80,    99,   118,
+      138,   158,   179,   202,   226,   252,   283,   318,
+      357,   401,   445,   494,   550,   611,   688,   784,
+      895,  1024,  1158,  1289,  1413,  1523,  1621,  1709,
+     1785,  1851,  1908,  1955,  1993,  2023,  2041,  2044,
+     2036,  2016,  1980,  1929,  1861,  1775,  1676,  1557,
+     1425,  1285,  1133,   976,   812,   641,   470,   295,
+      116,   -56,  -229,  -396,  -558,  -719,  -871, -1014,
+    -1153, -1280, -1398, -1505, -1597, -1681, -1757, -1823,
+    -1881, -1931, -1972, -2003, -2025, -2040, -2045, -2045,
+    -2040, -2029, -2013, -1993, -1969, -1947, -1928, -1914,
+    -1904, -1895, -1886, -1867, -1834, -1792, -1744, -1692,
+    -1638, -1585, -1528, -1460, -1373, -1275, -1173, -1070,
+     -973,  -884,  -802,  -730,  -662,  -601,  -547,  -496,
+     -448,  -403,  -362,  -326,  -294,  -263,  -233,  -204,
+     -175,  -146,  -120,   -96,   -74,   -53,   -34,   -16,
+};
+const int16_t wavetable_1_mip4[64] PROGMEM = {
+       -1,    30,    62,    99,   138,   179,   226,   282,
+      358,   446,   549,   689,   896,  1158,  1412,  1621,
+     1785,  1907,  1994,  2040,  2036,  1980,  1861,  1675,
+     1426,  1134,   811,   469,   118,  -228,  -559,  -870,
+    -1152, -1398, -1597, -1756, -1881, -1971, -2025, -2045,
+    -2039, -2013, -1969, -1928, -1903, -1886, -1834, -1744,
+    -1638, -1528, -1374, -1172,  -973,  -803,  -662,  -546,
+     -448,  -362,  -294,  -233,  -175,  -120,   -74,   -34,
+};
+const int16_t wavetable_1_mip5[32] PROGMEM = {
+        0,    62,   139,   224,   359,   547,   897,  1412,
+     1784,  1995,  2036,  1862,  1425,   812,   117,  -559,
+    -1154, -1596, -1883, -2024, -2042, -1967, -1907, -1831,
+    -1642, -1371,  -973,  -663,  -447,  -294,  -174,   -74,
+};
+const int16_t wavetable_1_mip6[16] PROGMEM = {
+       -5,   144,   340,   922,  1784,  2035,  1432,   114,
+    -1147, -1888, -2034, -1906, -1657,  -982,  -446,  -171,
+};
+const int16_t wavetable_1_mip7[8] PROGMEM = {
+       42,   322,  1767,  1402, -1125, -2048, -1550,  -507,
+};
+
+const int16_t *const wavetable_1_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_1_mip3, wavetable_1_mip4, wavetable_1_mip5, wavetable_1_mip6, wavetable_1_mip7
+};
+
+const int16_t wavetable_2_mip3[128] PROGMEM = {
+       98,    13,    71,    86,   125,   153,   205,   258,
+      338,   393,   455,   509,   536,   541,   546,   534,
+      540,   551,   577,   597,   633,   689,   773,   866,
+      937,  1007,  1063,  1105,  1135,  1157,  1172,  1197,
+     1260,  1355,  1479,  1563,  1625,  1672,  1699,  1712,
+     1727,  1736,  1743,  1734,  1723,  1703,  1666,  1614,
+     1544,  1477,  1423,  1389,  1368,  1345,  1332,  1309,
+     1270,  1205,  1147,  1063,   949,   815,   738,   684,
+      629,   507,   410,   219,    -3,   -66,  -129,  -161,
+     -208,  -253,  -342,  -536,  -647,  -679,  -715,  -729,
+     -763,  -787,  -825,  -856,  -898,  -955, -1031, -1138,
+    -1224, -1249, -1272, -1287, -1310, -1330, -1365, -1405,
+    -1450, -1513, -1583, -1652, -1758, -1836, -1886, -1892,
+    -1879, -1849, -1822, -1779, -1746, -1697, -1643, -1574,
+    -1512, -1436, -1376, -1281, -1177,  -948,  -653,  -479,
+     -348,  -253,  -166,   -86,   -27,    49,    94,   172,
+};
+const int16_t wavetable_2_mip4[64] PROGMEM = {
+      101,    41,   134,   193,   339,   450,   542,   536,
+      544,   570,   637,   769,   945,  1057,  1141,  1167,
+     1263,  1469,  1631,  1695,  1729,  1739,  1725,  1666,
+     1546,  1423,  1366,  1331,  1268,  1145,   947,   733,
+      626,   387,    35,  -138,  -190,  -369,  -637,  -712,
+     -758,  -825,  -895, -1038, -1216, -1271, -1308, -1363,
+    -1454, -1578, -1754, -1885, -1877, -1818, -1744, -1641,
+    -1510, -1370, -1165,  -674,  -346,  -165,   -26,   116,
+};
+const int16_t wavetable_2_mip5[32] PROGMEM = {
+       94,   104,   338,   528,   544,   638,   937,  1129,
+     1275,  1627,  1724,  1730,  1544,  1361,  1275,   940,
+      601,    77,  -237,  -578,  -788,  -886, -1209, -1303,
+    -1458, -1742, -1902, -1717, -1546, -1092,  -373,     2,
+};
+const int16_t wavetable_2_mip6[16] PROGMEM = {
+      107,   301,   592,   862,  1362,  1721,  1568,  1216,
+      585,  -287,  -759, -1140, -1510, -1842, -1536,  -423,
+};
+const int16_t wavetable_2_mip7[8] PROGMEM = {
+       77,   574,  1316,  1689,   448,  -687, -1637, -1371,
+};
+
+const int16_t *const wavetable_2_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_2_mip3, wavetable_2_mip4, wavetable_2_mip5, wavetable_2_mip6, wavetable_2_mip7
+};
+
+const int16_t wavetable_3_mip3[128] PROGMEM = {
+        6,    44,    70,    92,   125,   179,   235,   312,
+      407,   543,   655,   748,   843,   923,   982,  1006,
+     1022,  1033,  1044,  1052,  1060,  1063,  1071,  1077,
+     1096,  1109,  1125,  1144,  1177,  1212,  1254,  1295,
+     1332,  1375,  1421,  1479,  1531,  1592,  1649,  1701,
+     1759,  1822,  1863,  1911,  1947,  1952,  1960,  1953,
+     1946,  1925,  1881,  1829,  1773,  1713,  1674,  1624,
+     1574,  1512,  1424,  1330,  1229,  1108,   975,   821,
+      665,   499,   343,   186,     8,  -162,  -329,  -493,
+     -636,  -758,  -880,  -996, -1109, -1214, -1298, -1387,
+    -1459, -1537, -1635, -1693, -1756, -1821, -1867, -1882,
+    -1890, -1901, -1902, -1902, -1902, -1902, -1902, -1894,
+    -1880, -1863, -1836, -1789, -1735, -1669, -1609, -1562,
+    -1500, -1446, -1371, -1303, -1225, -1159, -1090, -1034,
+     -999,  -967,  -940,  -918,  -887,  -857,  -848,  -806,
+     -729,  -595,  -442,  -284,  -167,   -95,   -43,   -15,
+};
+const int16_t wavetable_3_mip4[64] PROGMEM = {
+       12,    67,   129,   234,   415,   653,   842,   980,
+     1022,  1044,  1059,  1070,  1094,  1125,  1175,  1255,
+     1333,  1423,  1534,  1647,  1760,  1868,  1942,  1958,
+     1945,  1883,  1771,  1670,  1575,  1427,  1226,   975,
+      662,   344,    12,  -332,  -634,  -879, -1109, -1302,
+    -1460, -1625, -1760, -1863, -1892, -1903, -1901, -1902,
+    -1880, -1835, -1733, -1611, -1503, -1374, -1227, -1091,
+     -995,  -943,  -885,  -844,  -727,  -439,  -167,   -47,
+};
+const int16_t wavetable_3_mip5[32] PROGMEM = {
+       25,   121,   423,   845,  1029,  1053,  1096,  1174,
+     1338,  1526,  1768,  1933,  1949,  1773,  1571,  1226,
+      671,     3,  -627, -1110, -1464, -1764, -1896, -1901,
+    -1884, -1734, -1497, -1233,  -989,  -905,  -699,  -191,
+};
+const int16_t wavetable_3_mip6[16] PROGMEM = {
+      -19,   456,  1019,  1100,  1315,  1786,  1915,  1587,
+      653,  -599, -1504, -1864, -1903, -1460, -1067,  -598,
+};
+const int16_t wavetable_3_mip7[8] PROGMEM = {
+      -16,   903,  1384,  1917,   651, -1528, -1815, -1089,
+};
+
+const int16_t *const wavetable_3_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_3_mip3, wavetable_3_mip4, wavetable_3_mip5, wavetable_3_mip6, wavetable_3_mip7
+};
+
+const int16_t wavetable_4_mip3[128] PROGMEM = {
+       33,   119,   174,   241,   301,   380,   453,   582,
+      745,   914,  1140,  1311,  1458,  1562,  1625,  1684,
+     1718,  1734,  1745,  1754,  1761,  1769,  1779,  1790,
+     1802,  1817,  1832,  1850,  1881,  1910,  1938,  1959,
+     1979,  1997,  2005,  2006,  1997,  1986,  1972,  1954,
+     1930,  1896,  1864,  1835,  1813,  1798,  1779,  1762,
+     1745,  1727,  1710,  1684,  1630,  1578,  1517,  1440,
+     1335,  1248,  1054,   821,   644,   479,   313,   163,
+      -20,  -176,  -278,  -401,  -500,  -613,  -724,  -825,
+     -926, -1025, -1119, -1212, -1289, -1392, -1518, -1570,
+    -1619, -1695, -1737, -1759, -1782, -1809, -1829, -1840,
+    -1855, -1872, -1882, -1887, -1892, -1893, -1891, -1888,
+    -1885, -1878, -1865, -1848, -1826, -1802, -1780, -1755,
+    -1727, -1692, -1653, -1601, -1565, -1547, -1531, -1518,
+    -1505, -1490, -1478, -1463, -1451, -1439, -1419, -1388,
+    -1366, -1318, -1256, -1173, -1051,  -861,  -666,  -333,
+};
+const int16_t wavetable_4_mip4[64] PROGMEM = {
+      -17,   190,   296,   466,   733,  1133,  1456,  1631,
+     1715,  1747,  1760,  1780,  1801,  1833,  1878,  1939,
+     1978,  2007,  1996,  1974,  1928,  1865,  1812,  1781,
+     1743,  1711,  1635,  1512,  1351,  1054,   633,   326,
+      -21,  -286,  -505,  -720,  -928, -1117, -1298, -1499,
+    -1633, -1731, -1786, -1825, -1858, -1880, -1893, -1889,
+    -1886, -1863, -1828, -1777, -1729, -1648, -1568, -1530,
+    -1506, -1475, -1453, -1417, -1362, -1258, -1049,  -641,
+};
+const int16_t wavetable_4_mip5[32] PROGMEM = {
+      -92,   323,   734,  1462,  1705,  1771,  1793,  1887,
+     1975,  2005,  1921,  1818,  1744,  1638,  1335,   671,
+      -20,  -506,  -927, -1304, -1640, -1783, -1860, -1889,
+    -1886, -1827, -1723, -1575, -1501, -1453, -1361, -1042,
+};
+const int16_t wavetable_4_mip6[16] PROGMEM = {
+     -273,   878,  1689,  1810,  1971,  1929,  1744,  1313,
+       -6,  -920, -1630, -1852, -1894, -1707, -1503, -1352,
+};
+const int16_t wavetable_4_mip7[8] PROGMEM = {
+     -265,  1622,  1936,  1773,   155, -1690, -1777, -1656,
+};
+
+const int16_t *const wavetable_4_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_4_mip3, wavetable_4_mip4, wavetable_4_mip5, wavetable_4_mip6, wavetable_4_mip7
+};
+
+const int16_t wavetable_5_mip3[128] PROGMEM = {
+        3,    38,    65,    91,   121,   143,   182,   218,
+      255,   319,   385,   468,   560,   642,   715,   787,
+      859,   947,  1022,  1088,  1144,  1190,  1244,  1297,
+     1349,  1403,  1459,  1518,  1574,  1621,  1673,  1724,
+     1775,  1830,  1858,  1873,  1874,  1849,  1819,  1779,
+     1731,  1688,  1623,  1559,  1489,  1428,  1363,  1300,
+     1241,  1175,  1108,  1048,   989,   923,   859,   799,
+      736,   682,   628,   572,   515,   457,   397,   340,
+      279,   222,   159,    99,    36,   -29,   -90,  -153,
+     -221,  -279,  -341,  -412,  -477,  -535,  -602,  -663,
+     -729,  -807,  -882,  -954, -1026, -1099, -1164, -1234,
+    -1301, -1372, -1440, -1512, -1588, -1659, -1729, -1806,
+    -1880, -1953, -2012, -2039, -2038, -2027, -1972, -1903,
+    -1833, -1773, -1712, -1627, -1566, -1493, -1423, -1361,
+    -1299, -1222, -1132, -1054,  -972,  -880,  -781,  -692,
+     -624,  -540,  -459,  -382,  -302,  -244,  -166,   -88,
+};
+const int16_t wavetable_5_mip4[64] PROGMEM = {
+       -5,    67,   118,   180,   260,   386,   559,   716,
+      862,  1023,  1142,  1243,  1349,  1459,  1573,  1671,
+     1778,  1859,  1871,  1818,  1734,  1625,  1490,  1364,
+     1239,  1110,   987,   860,   737,   628,   514,   398,
+      280,   160,    35,   -91,  -218,  -343,  -476,  -599,
+     -733,  -880, -1028, -1164, -1302, -1439, -1587, -1729,
+    -1883, -2008, -2044, -1972, -1835, -1706, -1562, -1425,
+    -1297, -1136,  -971,  -782,  -618,  -461,  -306,  -168,
+};
+const int16_t wavetable_5_mip5[32] PROGMEM = {
+      -18,   122,   261,   551,   872,  1140,  1351,  1568,
+     1780,  1871,  1732,  1496,  1235,   987,   738,   516,
+      279,    37,  -220,  -471,  -736, -1024, -1305, -1581,
+    -1887, -2040, -1842, -1562, -1292,  -967,  -615,  -311,
+};
+const int16_t wavetable_5_mip6[16] PROGMEM = {
+      -34,   279,   866,  1356,  1775,  1750,  1221,   757,
+      266,  -201,  -756, -1283, -1898, -1861, -1272,  -630,
+};
+const int16_t wavetable_5_mip7[8] PROGMEM = {
+      -71,   817,  1768,  1283,   244,  -712, -1858, -1305,
+};
+
+const int16_t *const wavetable_5_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_5_mip3, wavetable_5_mip4, wavetable_5_mip5, wavetable_5_mip6, wavetable_5_mip7
+};
+
+const int16_t wavetable_6_mip3[128] PROGMEM = {
+       13,   124,   327,   426,   523,   605,   708,   808,
+      903,   993,  1097,  1190,  1281,  1339,  1400,  1454,
+     1510,  1540,  1574,  1602,  1636,  1665,  1698,  1716,
+     1746,  1766,  1786,  1790,  1800,  1800,  1815,  1815,
+     1831,  1839,  1863,  1876,  1889,  1881,  1873,  1858,
+     1853,  1839,  1832,  1802,  1772,  1721,  1680,  1634,
+     1595,  1538,  1470,  1376,  1293,  1176,  1070,   955,
+      830,   659,   452,   160,   -81,  -408,  -818, -1213,
+    -1409, -1629, -1776, -1891, -1952, -2010, -2010, -2039,
+    -2026, -2039, -2005, -1999, -1922, -1884, -1735, -1598,
+     -668,    23,   177,   307,   321,   342,   337,   339,
+      332,   317,   295,   212,   159,  -138, -1491, -1710,
+    -1787, -1834, -1875, -1895, -1912, -1912, -1906, -1891,
+    -1877, -1852, -1817, -1753, -1665, -1457, -1200,  -998,
+     -775,  -537,  -414,  -327,  -264,  -222,  -182,  -146,
+     -120,   -96,   -77,   -62,   -48,   -32,   -18,    -7,
+};
+const int16_t wavetable_6_mip4[64] PROGMEM = {
+        8,   313,   515,   713,   896,  1101,  1271,  1404,
+     1501,  1577,  1631,  1699,  1741,  1787,  1795,  1813,
+     1827,  1861,  1887,  1871,  1852,  1826,  1772,  1673,
+     1599,  1461,  1294,  1059,   841,   425,   -77,  -827,
+    -1433, -1780, -1950, -2035, -2013, -2046, -1892, -1836,
+     -724,   263,   298,   352,   334,   269,   174, -1203,
+    -1889, -1809, -1957, -1869, -1906, -1791, -1673, -1199,
+     -782,  -388,  -287,  -163,  -136,   -61,   -62,    -4,
+};
+const int16_t wavetable_6_mip5[32] PROGMEM = {
+       67,   511,   910,  1260,  1516,  1619,  1765,  1777,
+     1855,  1853,  1886,  1732,  1628,  1246,   867,  -163,
+    -1364, -2026, -1941, -2048,  -709,   387,   350,   -83,
+    -1808, -1877, -1904, -1614,  -769,  -251,  -124,   -54,
+};
+const int16_t wavetable_6_mip6[16] PROGMEM = {
+      131,   884,  1538,  1693,  1891,  1801,  1654,   708,
+    -1184, -2048,  -717,   451, -1426, -2016,  -773,  -130,
+};
+const int16_t wavetable_6_mip7[8] PROGMEM = {
+      589,  1247,  1957,  1610, -1176,  -916,  -813, -1384,
+};
+
+const int16_t *const wavetable_6_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_6_mip3, wavetable_6_mip4, wavetable_6_mip5, wavetable_6_mip6, wavetable_6_mip7
+};
+
+const int16_t wavetable_7_mip3[128] PROGMEM = {
+       17,   103,   166,   224,   282,   348,   403,   442,
+      478,   520,   570,   614,   659,   695,   732,   781,
+      823,   861,   899,   945,   993,  1040,  1080,  1122,
+     1171,  1221,  1264,  1308,  1345,  1387,  1423,  1464,
+     1509,  1548,  1586,  1616,  1647,  1686,  1727,  1759,
+     1787,  1809,  1838,  1860,  1883,  1895,  1907,  1909,
+     1882,  1852,  1820,  1765,  1696,  1621,  1544,  1427,
+     1242,  1012,   856,   695,   450,   221,     3,  -155,
+     -318,  -480,  -680,  -843,  -937, -1044, -1166, -1285,
+    -1376, -1460, -1533, -1596, -1648, -1686, -1725, -1773,
+    -1811, -1853, -1874, -1884, -1887, -1887, -1880, -1868,
+    -1840, -1807, -1782, -1768, -1757, -1748, -1739, -1733,
+    -1725, -1719, -1712, -1708, -1701, -1696, -1685, -1672,
+    -1642, -1610, -1588, -1553, -1515, -1474, -1434, -1391,
+    -1356, -1209,  -984,  -789,  -627,  -503,  -416,  -353,
+     -286,  -238,  -178,  -145,  -110,   -71,   -48,   -27,
+};
+const int16_t wavetable_7_mip4[64] PROGMEM = {
+       24,   167,   283,   402,   478,   568,   657,   735,
+      823,   899,   993,  1081,  1171,  1266,  1346,  1425,
+     1507,  1586,  1647,  1727,  1784,  1838,  1879,  1910,
+     1882,  1820,  1693,  1548,  1234,   851,   467,    -1,
+     -306,  -683,  -941, -1166, -1378, -1533, -1647, -1727,
+    -1813, -1875, -1886, -1882, -1839, -1783, -1757, -1740,
+    -1725, -1713, -1701, -1687, -1643, -1584, -1516, -1432,
+    -1344,  -997,  -620,  -421,  -287,  -187,  -104,   -52,
+};
+const int16_t wavetable_7_mip5[32] PROGMEM = {
+       40,   284,   488,   650,   824,   986,  1177,  1344,
+     1508,  1652,  1786,  1882,  1885,  1705,  1246,   438,
+     -335,  -945, -1370, -1650, -1805, -1900, -1830, -1761,
+    -1721, -1707, -1639, -1522, -1301,  -655,  -272,  -120,
+};
+const int16_t wavetable_7_mip6[16] PROGMEM = {
+       70,   470,   833,  1156,  1524,  1765,  1911,  1201,
+     -316, -1385, -1800, -1863, -1690, -1690, -1191,  -314,
+};
+const int16_t wavetable_7_mip7[8] PROGMEM = {
+      143,   801,  1507,  1865,  -221, -1845, -1759, -1152,
+};
+
+const int16_t *const wavetable_7_mipmap[WAVETABLE_MIPMAP_LEVELS] PROGMEM = {
+    wavetable_7_mip3, wavetable_7_mip4, wavetable_7_mip5, wavetable_7_mip6, wavetable_7_mip7
+};
+
+#endif // WAVETABLE_MIPMAPS_H
@@ -25,17 +25,50 @@
  * configures the serial port speed which is used to send
  * status information to the display board (calibration, muted, etc.)
  * 
+ * both boards must be built with the same value.
+ * 115200 baud is 2.1 % off on a 16 MHz AVR, but both boards have the same
+ * crystal and divider, so the link itself has no relative error.
+ * the previous firmware used 38400.
+ * 
+ */
+#define SERIAL_SPEED        115200 // serial com speed
+
+/*
+ * LINK_STATUS_FRAMES
+ *
+ * if defined, the theremin streams its DDS phase increment, register and volume
+ * in a framed message (see link_protocol.h) every LINK_STATUS_PERIOD_MS,
+ * the display shows the note computed from it instead of measuring the
+ * GATE square wave, so there is no measurement latency.
+ * the display falls back to the GATE measurement when no frames arrive.
+ *
  */
-#define SERIAL_SPEED        38400 // serial com speed
+#define LINK_STATUS_FRAMES
+
+/*
+ * DISPLAY_I2C_FAST_MODE
+ *
+ * if defined, the display board talks to the HT1635 at 400 kHz (I2C fast mode)
+ * instead of 100 kHz, a frame is sent about 4x faster.
+ * fast mode is only used when external pull-ups are found on SDA/SCL at startup
+ * (the internal ones are too weak for 400 kHz), and the driver falls back to
+ * 100 kHz by itself after repeated bus errors.
+ *
+ */
+#define DISPLAY_I2C_FAST_MODE
 
 /*
  * SERIAL_DEBUG_MESSAGES
  * 
  * emits debug information via serial port if defined.
- * to mute debug printouts, comment the below line out.
+ * to enable debug printouts, uncomment the below line.
+ * 
+ * the serial port is the link to the display board (STATE_CMD_xxx, status frames),
+ * the ATmega328P has no second UART, so the debug text shares its bandwidth
+ * and is meant for bench tests only. disabled by default.
  * 
  */
-#define SERIAL_DEBUG_MESSAGES
+//#define SERIAL_DEBUG_MESSAGES
 #ifdef SERIAL_DEBUG_MESSAGES
     #define DEBUG_PRINT(x)     Serial.print(x)
     #define DEBUG_PRINTLN(x)   Serial.println(x)
@@ -72,7 +105,34 @@
 #define CV_OUTPUT_MODE_OFF 0            // disables the CV output - this saves resources - for a slightly better audio quality if not needed at all.
 #define CV_OUTPUT_MODE_LOG 1            // uses a logarithmic curve for CV output (1V/Oct for Moog & Roland)
 #define CV_OUTPUT_MODE_LINEAR 2         // uses a linear transfer function for CV output (819Hz/V for Korg & Yamaha)
+#ifndef CV_OUTPUT_MODE                  // may be set by the build, e.g. the cycle benchmark (firmware/host)
 #define CV_OUTPUT_MODE CV_OUTPUT_MODE_OFF
+#endif
+
+/*
+ * CV_UPDATE_TICKS, CV_SLEW_STEP (CV_OUTPUT_MODE_LOG and CV_OUTPUT_MODE_LINEAR)
+ *
+ * the pitch CV is computed by its own main loop task, decoupled from the pitch
+ * processing: every CV_UPDATE_TICKS timer ticks (32 us) the latest pitch is
+ * converted (log2 by table lookup, 32-bit math only) and the output moves
+ * towards it by at most CV_SLEW_STEP DAC steps (819 steps per octave in the
+ * log mode, ~1V), 0 jumps at once. e.g. 32 steps per 16 ticks glide an octave
+ * in ~13 ms.
+ *
+ * The default of 16 ticks (1.95 kHz) is well above what a CV input follows.
+ * scheduler_run() starts one periodic task per pass. Together with ui_adc_task,
+ * which runs every 4 ticks, the CV task takes 5 passes out of every 16 ticks,
+ * where a 4-tick CV rate would take 8.
+ *
+ * The cycle cost per update is not measured yet (make cycles in firmware/host
+ * is unverified). By operation count, the old in-loop conversion of a changed
+ * pitch ran log2U16() with five 64-bit multiplies (__muldi3) inside the pitch
+ * processing. The table version does two PROGMEM word reads and one
+ * 16x16->32 multiply, and cv_task() runs it outside the pitch processing.
+ *
+ */
+#define CV_UPDATE_TICKS     16          // 1.95 kHz
+#define CV_SLEW_STEP        0           // no slew limiting
 
 /*
  * GATE OUTPUT (not available on this mod)
@@ -82,6 +142,37 @@
  * by a second Arduino which in turn drives the display.
  */
 
+/*
+ * MIDI_OUTPUT
+ *
+ * if defined, the GATE pin (PC2) carries a MIDI OUT stream instead of the
+ * square wave: ISR(INT1_vect) shifts out one bit per SAMPLE_CLK, which at
+ * 16 MHz / 512 = 31250 Hz is exactly the MIDI baud rate. wire it to pin 5 of
+ * a DIN socket through 220 Ohm, pin 4 to +5 V through 220 Ohm.
+ * the UART stays the link to the display, which then follows the pitch from the
+ * status frames only, so MIDI_OUTPUT needs LINK_STATUS_FRAMES.
+ *
+ * every MIDI_UPDATE_TICKS the main loop derives from the clamped pitch and volume:
+ * - note on (MIDI_NOTE_VELOCITY) when the volume rises, note off when it falls to 0
+ * - 14-bit pitch bend relative to the playing note, +-MIDI_BEND_RANGE semitones
+ *   (set the same range on the synth), a new note when the hand leaves it
+ * - the volume as control change MIDI_VOLUME_CC (11 = expression)
+ * on MIDI_CHANNEL (1..16). only changed values are sent, with running status,
+ * and an update waits while the previous one still shifts out, so the stream
+ * never exceeds the 3125 bytes/s of MIDI.
+ *
+ */
+//#define MIDI_OUTPUT
+#define MIDI_CHANNEL            1
+#define MIDI_BEND_RANGE         2       // semitones
+#define MIDI_VOLUME_CC          11
+#define MIDI_NOTE_VELOCITY      100
+#define MIDI_UPDATE_TICKS       63      // ~2 ms
+
+#if defined(MIDI_OUTPUT) && !defined(LINK_STATUS_FRAMES)
+    #error "MIDI_OUTPUT takes the GATE pin, the display needs LINK_STATUS_FRAMES for the pitch"
+#endif
+
 
  
 /*
@@ -94,6 +185,31 @@
  */
 //#define DEBUG_DDS_ISR_BY_RED_LED
 
+/*
+ * ISR_BENCHMARK
+ *
+ * on-target timing regression check without an oscilloscope:
+ * ISR(INT1_vect) is stamped with the 16 MHz Timer1 on entry and exit,
+ * the counters are collected over one second intervals and sent by the
+ * theremin as the answer to a STATE_CMD_DIAGNOSTICS query:
+ *
+ *   ISR min=<cycles> avg=<cycles> max=<cycles> overruns=<count> missed=<count>
+ *   LOOP rate=<iterations> ticks=<samples>
+ *   PITCH age avg=<ticks> max=<ticks> updates=<count>
+ *   VOLUME age avg=<ticks> max=<ticks> updates=<count>
+ *   TASK <index> runs=<count> worst=<ticks>      (one line per main loop task)
+ *
+ * the DDS deadline is 512 cycles (32 us), overruns counts the ISR runs above it,
+ * missed the runs that ended with the next SAMPLE_CLK already pending (INTF1).
+ * the ages are the SAMPLE_CLK ticks a new pitch/volume value waits for loop(),
+ * worst the longest run of a scheduler task (see theremin_main.cpp) in ticks.
+ * run it after every change to ihandlers.cpp, for the -O0 and the
+ * optimized (OT4_FW_OPTIMIZED) platformio environment.
+ * when not defined, none of this is compiled in.
+ *
+ */
+//#define ISR_BENCHMARK
+
 /*
  * INCLUDES A PRECISE PURE SINEWAVE IF DEFINED
  * as waveform at index 0 (the very first)
@@ -112,6 +228,88 @@
  */
 //#define WAVEFORM_INCLUDE_PURE_SINE
 
+/*
+ * WAVEFORM_INTERPOLATION
+ *
+ * if defined, the DDS generator blends the two adjacent wavetable
+ * entries using the 6 fractional bits of the 10.6 phase accumulator
+ * (linear interpolation) instead of playing the nearest sample.
+ * this removes most of the zipper noise and aliasing on the upper register
+ * at the cost of a second table read and one hardware multiply per sample.
+ *
+ * ISR(INT1_vect) cost, estimated from the instruction sequence, NOT measured
+ * (no cycle report exists yet, measure the red LED pulse width of
+ * DEBUG_DDS_ISR_BY_RED_LED on the scope or the avg/max of ISR_BENCHMARK,
+ * CV_OUTPUT_MODE_OFF):
+ *   - nearest sample (default)   1 table read, no extra math
+ *   - linear interpolation       + 1 table read (est. ~6 cycles)
+ *                                + subtract and 16x16->32 hardware multiply (est. ~20 cycles)
+ *                                + shift and add (est. ~8 cycles)
+ *   i.e. an estimated ~35 cycles (~2.2 us) on top of the default ISR,
+ *   which would be well inside the 32 us SAMPLE_CLK period.
+ *
+ */
+//#define WAVEFORM_INTERPOLATION
+
+/*
+ * WAVEFORM_MIPMAPS
+ *
+ * if defined, each wavetable also gets shorter band-limited copies
+ * (128, 64, 32, 16 and 8 points) in PROGMEM, generated by
+ * OT4-HT-theremin-firmware/scripts/gen_wavetable_mipmaps.py into wavetable_mipmaps.h.
+ * whenever the pitch changes the main loop picks the level whose harmonics
+ * all stay below the Nyquist frequency, so bright timbres no longer alias
+ * on the upper register; the ISR just plays the selected table.
+ *
+ * costs about 4 KB of flash (see the budget in wavetable_mipmaps.h)
+ * and one 16x8 hardware multiply in the ISR while a short level is playing.
+ *
+ */
+//#define WAVEFORM_MIPMAPS
+
+/*
+ * WAVEFORM_COMPRESSED
+ *
+ * if defined, the DDS plays 16 timbres from wavetable_compressed.h instead of
+ * the 8 full 1024-point tables: the 8 OpenTheremin tables, the pure sine and
+ * 7 band-limited additive waveforms (triangle, square, clarinet, hollow,
+ * flute, oboe, bell), generated by
+ * OT4-HT-theremin-firmware/scripts/gen_wavetable_compressed.py.
+ * each table is stored losslessly in the smallest fitting format:
+ * quarter-wave (514 bytes) or half-wave (1024 bytes) folding for symmetric shapes,
+ * 8-bit offsets from 8-sample block bases (1280 bytes) or 12-bit packing (1536 bytes).
+ * the 16 timbres take 15.1 KB of flash, less than the 16 KB of the 8 full tables.
+ *
+ * ISR(INT1_vect) decodes the sample with a switch on the format, no loop:
+ *   QUARTER   1 word read, fold and negate (compare, subtract, conditional negate)
+ *   BLOCK8    1 word read of the block base + 1 byte read of the offset, add
+ *   PACKED12  index * 3 / 2, 1 word read, shift or mask, subtract 2048
+ * twice per sample with WAVEFORM_INTERPOLATION. the extra ISR cycles of each
+ * path are not measured yet: build with ISR_BENCHMARK, select a timbre of the
+ * format (see wavetable_compressed.h) and compare the avg/max against the
+ * default build.
+ * WAVEFORM_INCLUDE_PURE_SINE is not needed (the sine is part of the set),
+ * WAVEFORM_MIPMAPS can't be combined with it.
+ *
+ */
+//#define WAVEFORM_COMPRESSED
+
+/*
+ * AUDIO_BLOCK_PIPELINE
+ *
+ * if defined, the main loop renders the audio samples ahead of time
+ * (wavetable fetch, volume scaling, DAC framing, phase update and GATE level)
+ * into a 32 word single-producer/single-consumer ring buffer, and
+ * ISR(INT1_vect) only latches and sends the next pre-framed word.
+ * this frees most of the ISR time, e.g. for CV_OUTPUT_MODE_LOG.
+ *
+ * the ring holds 1 ms of audio: whenever the main loop is blocked for longer
+ * the last word is repeated and an underrun is counted; the count is printed
+ * in the answer to a STATE_CMD_DIAGNOSTICS query.
+ *
+ */
+//#define AUDIO_BLOCK_PIPELINE
+
 /*
  *  PITCH_FIELD_MODE
  *  
@@ -131,6 +329,118 @@
 #define PITCH_FIELD_MODE_SYMMETRICAL 1            // experimental
 #define PITCH_FIELD_MODE PITCH_FIELD_MODE_LEGACY
 
+/*
+ * PITCH_MEASUREMENT_WINDOW
+ *
+ * number of consecutive pitch periods (ICR1 captures) averaged by the ISR
+ * into each pitch value, as a moving window updated on every capture.
+ * the jitter of the averaged value drops with the square root of the window,
+ * while its delay is only half the window, so the smoothing in loop() can be
+ * made lighter for the same stability.
+ * allowed values: 1 (single period, original behaviour), 2, 4 or 8.
+ * 
+ */
+#define PITCH_MEASUREMENT_WINDOW 1
+
+/*
+ * PITCH_FILTER_MODE / VOLUME_FILTER_MODE
+ *
+ * smoothing applied by loop() to the pitch and volume counters:
+ *
+ * - FILTER_MODE_EMA
+ *   exponential moving average y += (x - y) / 2^shift.
+ *   with shift 2 this is the original OpenTheremin smoothing.
+ *
+ * - FILTER_MODE_TWO_POLE
+ *   two cascaded EMAs with the same shift, rejects more jitter for a similar lag.
+ *
+ * - FILTER_MODE_ADAPTIVE
+ *   one-euro style: the time constant shrinks as the hand moves faster,
+ *   fast movements follow with little lag while held notes stay steady.
+ *
+ * the xxx_FILTER_SHIFT (1..FILTER_MAX_SHIFT) sets the time constant of 2^shift updates,
+ * the lowest cutoff for the adaptive mode.
+ * both can be changed at runtime, without reflashing, by sending
+ * STATE_CMD_PITCH_FILTER_BASE + mode, STATE_CMD_PITCH_FILTER_SHIFT_BASE + shift
+ * (and the VOLUME equivalents) to the theremin.
+ * 
+ */
+#define FILTER_MODE_EMA 0
+#define FILTER_MODE_TWO_POLE 1
+#define FILTER_MODE_ADAPTIVE 2
+#define FILTER_MAX_SHIFT 7
+
+#define PITCH_FILTER_MODE FILTER_MODE_EMA
+#define PITCH_FILTER_SHIFT 2
+#define VOLUME_FILTER_MODE FILTER_MODE_EMA
+#define VOLUME_FILTER_SHIFT 2
+
+/*
+ * PITCH_QUANTIZER
+ *
+ * assisted intonation: if defined, loop() pulls the pitch towards the nearest
+ * equal-tempered note before it goes to the wave generator and the pitch CV.
+ * the notes are a PROGMEM table of phase increments (scripts/gen_quantizer_notes.py),
+ * no float math per update. while the pitch stays within the range of the
+ * note held, the usual case, an update is two 16 bit compares, a glide step
+ * until the note is reached and, below hard snap, one small multiply: no table
+ * read, no search. leaving the note runs the binary search and a few 16x16 bit
+ * multiplies (the concert A and register are folded into 16 bit factors when
+ * the concert A is set) to find the next note and its range.
+ * the cycle counts of both paths are not measured on the target yet.
+ * the highest note is the last one the clamped pitch (16383) can reach in
+ * the register, pitches above it stay on it.
+ *
+ * - strength 0 (off) .. QUANTIZER_STRENGTH_MAX (hard snap): the pitch moves
+ *   strength / QUANTIZER_STRENGTH_MAX of the way to the note.
+ * - glide 0 (jump) .. QUANTIZER_GLIDE_MAX: the note followed moves to a new note
+ *   in about 2^glide pitch updates, a portamento between snapped notes.
+ *
+ * both can be changed at runtime by sending STATE_CMD_QUANTIZER_STRENGTH_BASE + strength
+ * and STATE_CMD_QUANTIZER_GLIDE_BASE + glide to the theremin.
+ * the display board sends its concert A reference as STATE_CMD_CONCERT_A_BASE + (A - 430)
+ * whenever it is loaded or changed, so the notes match the tuner.
+ *
+ */
+//#define PITCH_QUANTIZER
+#define QUANTIZER_STRENGTH_MAX      8
+#define QUANTIZER_GLIDE_MAX         7
+#define QUANTIZER_STRENGTH_DEFAULT  QUANTIZER_STRENGTH_MAX
+#define QUANTIZER_GLIDE_DEFAULT     3
+
+/*
+ * CALIBRATION_DRIFT_TRACKING
+ *
+ * if defined, pitchCalibrationBase and volCalibrationBase follow the slow
+ * drift of the RF oscillators (temperature, room) while the theremin is muted,
+ * so a long set doesn't need a recalibration.
+ * only hands-away samples close to the current base are used, the trim is limited
+ * to CALIBRATION_DRIFT_LIMIT ticks and stored in EEPROM only when it moved
+ * by more than CALIBRATION_DRIFT_COMMIT ticks since the last store.
+ * muted doesn't mean hands away: the samples must also have settled, within a
+ * small spread for ~1.5 s before the ~6 s average starts (calibration.cpp).
+ * a hand held very still near the edge of the field while muted can still pass
+ * for drift, the limit bounds the damage, a recalibration undoes it.
+ *
+ */
+#define CALIBRATION_DRIFT_TRACKING
+
+/*
+ * VOLUME_CURVE_DEFAULT
+ *
+ * volume response curve used until another one is selected by sending
+ * STATE_CMD_VOLUME_CURVE_BASE + n to the theremin (the choice is kept in EEPROM).
+ * the curves are PROGMEM lookup tables generated by
+ * OT4-HT-theremin-firmware/scripts/gen_volume_curves.py, edit its USER_CURVE
+ * points to shape the custom curve.
+ * 
+ */
+#define VOLUME_CURVE_PSEUDO_EXPONENTIAL 0       // c * (c + 2), original OpenTheremin response
+#define VOLUME_CURVE_EXPONENTIAL 1              // true exponential, 48 dB range
+#define VOLUME_CURVE_LINEAR 2
+#define VOLUME_CURVE_CUSTOM 3                   // user defined curve
+#define VOLUME_CURVE_DEFAULT VOLUME_CURVE_PSEUDO_EXPONENTIAL
+
 
 /**
  * SERIAL COMMAND COMMUNICATION PROTOCOL
@@ -152,12 +462,29 @@
 #define STATE_CMD_CALIBRATION           0x16    // SYN
 #define STATE_CMD_CALIBRATION_SUCCESS   0x06    // ACK
 #define STATE_CMD_CALIBRATION_ERROR     0x15    // NAK
+#define STATE_CMD_CALIBRATION_QUICK     0x17    // ETB, quick recalibration from the stored DAC values
+#define STATE_CMD_CALIBRATION_CANCEL    0x18    // CAN, display -> theremin, echoed when cancelled
+#define STATE_CMD_CALIBRATION_PROGRESS_BASE 0xC0 // + 0..19, calibration progress in 5 % steps
 #define STATE_CMD_MUTE                  0x04    // EOT
 #define STATE_CMD_UNMUTE                0x02    // STX
 #define STATE_CMD_BUTTON_SHORT_PRESS    0x07    // BEL
 #define STATE_CMD_BUTTON_LONG_PRESS     0x08    // BS
+#define STATE_CMD_DIAGNOSTICS           0x05    // ENQ - theremin answers with runtime counters as text
 
 #define STATE_CMD_WAVEFORM_BASE         0x80
+#define STATE_CMD_WAVEFORM_MAX          16      // + 0..15, waveform index
+#define STATE_CMD_VOLUME_CURVE_BASE     0x90    // + VOLUME_CURVE_xxx, echoed back when applied
+
+#define STATE_CMD_PITCH_FILTER_BASE         0xA0    // + FILTER_MODE_xxx
+#define STATE_CMD_VOLUME_FILTER_BASE        0xA4    // + FILTER_MODE_xxx
+#define STATE_CMD_PITCH_FILTER_SHIFT_BASE   0xA8    // + shift (1..FILTER_MAX_SHIFT)
+#define STATE_CMD_VOLUME_FILTER_SHIFT_BASE  0xB0    // + shift (1..FILTER_MAX_SHIFT)
+
+#define STATE_CMD_QUANTIZER_GLIDE_BASE      0xB8    // + glide (0..QUANTIZER_GLIDE_MAX)
+#define STATE_CMD_QUANTIZER_STRENGTH_BASE   0xD4    // + strength (0..QUANTIZER_STRENGTH_MAX)
+#define STATE_CMD_CONCERT_A_BASE            0xE0    // + 0..15, concert A 430..445 Hz, display -> theremin
+#define STATE_CMD_CONCERT_A_MIN             430
+#define STATE_CMD_CONCERT_A_COUNT           16
 
 #define STATE_CMD_REGISTER_LOW          0x10    // DC1
 #define STATE_CMD_REGISTER_MID          0x11    // DC2
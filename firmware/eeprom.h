@@ -24,6 +24,8 @@
 #include <inttypes.h>
 #include <avr/eeprom.h>
 #include <avr/io.h>
+#include <string.h>
+#include <util/crc16.h>
 
 
 
@@ -143,4 +145,95 @@ struct EEPROMClass {
 static EEPROMClass EEPROM;
 
 
+/**
+ *   @brief EESettings class.
+ *   
+ *   A versioned settings record of type T, protected by a CRC and wear-leveled
+ *   over a ring of SLOTS copies starting at EEPROM address BASE.
+ *   Every save() goes to the next slot and only rewrites the bytes that differ,
+ *   so a cell is erased at most once per SLOTS saves.
+ *   
+ *   Slot layout: [sequence][version][T][CRC-CCITT of version and T]
+ *   The sequence byte is written last and counts up by one per save, the newest
+ *   slot is the last of the run of consecutive sequence numbers from slot 0.
+ *   load() finds it from the sequence bytes and reads it with a single block read,
+ *   a slot with a bad CRC or another VERSION (power loss during the write,
+ *   blank or foreign EEPROM) falls back to the slot before it.
+ */
+template< typename T, int BASE, uint8_t SLOTS, uint8_t VERSION > struct EESettings {
+
+    struct Slot {
+        uint8_t sequence;
+        uint8_t version;
+        T data;
+        uint16_t crc;
+    };
+
+    static const int SLOT_SIZE = sizeof(Slot);
+    static const int END = BASE + SLOTS * SLOT_SIZE;   //First address after the ring.
+
+    T data;                 //Working copy: the defaults of the caller until load() found a record.
+
+    //Reads the newest valid record into data. false: none found, data is left as it is.
+    bool load(){
+        uint8_t newest = 0;
+        uint8_t sequence = EEPROM.read( address( 0 ) );
+        while( newest + 1 < SLOTS && EEPROM.read( address( newest + 1 ) ) == (uint8_t)( sequence + 1 ) ){
+            ++newest;
+            ++sequence;
+        }
+
+        Slot slot;
+        for( uint8_t tries = SLOTS ; tries ; --tries ){
+            eeprom_read_block( &slot, (const void*) address( newest ), SLOT_SIZE );
+            if( slot.version == VERSION && slot.crc == crc( slot ) ){
+                data = slot.data;
+                _slot = newest;
+                _sequence = slot.sequence;
+                _valid = true;
+                return true;
+            }
+            newest = newest ? newest - 1 : SLOTS - 1;
+        }
+        return false;
+    }
+
+    //Writes data to the next slot, unless it equals the current record. true: written.
+    bool save(){
+        Slot slot;
+        if( _valid ){
+            eeprom_read_block( &slot, (const void*) address( _slot ), SLOT_SIZE );
+            if( memcmp( &slot.data, &data, sizeof(T) ) == 0 ) return false;
+        }
+        slot.sequence = _sequence + 1;
+        slot.version = VERSION;
+        slot.data = data;
+        slot.crc = crc( slot );
+
+        uint8_t next = ( _slot + 1 ) % SLOTS;
+        const uint8_t *ptr = (const uint8_t*) &slot;
+        for( int i = 1 ; i < SLOT_SIZE ; ++i )  EEPROM.update( address( next ) + i, ptr[i] );
+        EEPROM.update( address( next ), slot.sequence );     //Commit.
+        _slot = next;
+        _sequence = slot.sequence;
+        _valid = true;
+        return true;
+    }
+
+private:
+    uint8_t _slot = SLOTS - 1;  //Slot of the current record, without one the next save() starts at slot 0.
+    uint8_t _sequence = 0xFF;
+    bool _valid = false;        //_slot holds a valid record.
+
+    static int address( uint8_t slot )    { return BASE + slot * SLOT_SIZE; }
+
+    static uint16_t crc( const Slot &slot ){
+        uint16_t crc = _crc_ccitt_update( 0xFFFF, slot.version );
+        const uint8_t *ptr = (const uint8_t*) &slot.data;
+        for( int count = sizeof(T) ; count ; --count )  crc = _crc_ccitt_update( crc, *ptr++ );
+        return crc;
+    }
+};
+
+
 #endif // _EEPROM_H_
@@ -0,0 +1,49 @@
+/**
+ * @file bench.h
+ * @brief cycle markers of the benchmark firmwares, counted by simavr_cycles.c
+ *
+ * BENCH(id, call) writes id to GPIOR0 before the call and 0 after it, the
+ * simulator counts the cycles in between. bench_name() sends the name of an
+ * id through GPIOR2 (id) and GPIOR1 (characters) once at the start.
+ * Id 1 is the empty marker pair, its count is taken off all others, so a
+ * report is the cost of the call itself including argument setup, call and ret.
+ *
+ * The measured functions live in other translation units (no LTO here),
+ * so the compiler can't move their work across the volatile marker writes.
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <Arduino.h>
+#include <avr/sleep.h>
+
+#define BENCH_ID_MARKER     1       // empty marker pair, the overhead removed from the others
+#define BENCH_REPEAT        16      // calls per input value
+
+static inline void bench_name(uint8_t id, const char *name) {
+    GPIOR2 = id;
+    char c;
+    while ((c = pgm_read_byte(name++))) { GPIOR1 = c; }
+    GPIOR1 = 0;
+}
+
+#define BENCH(id, call) do {                        \
+        asm volatile("" ::: "memory");              \
+        GPIOR0 = (id);                              \
+        call;                                       \
+        GPIOR0 = 0;                                 \
+        asm volatile("" ::: "memory");              \
+    } while (0)
+
+/** @brief Ends the simulation: simavr quits on a sleep with interrupts off. */
+static inline void bench_done() {
+    cli();
+    sleep_enable();
+    sleep_cpu();
+}
+
+#endif // _BENCH_H_
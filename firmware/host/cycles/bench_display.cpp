@@ -0,0 +1,72 @@
+/**
+ * @file bench_display.cpp
+ * @brief cycle benchmark of the display tuner math, see bench.h
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#include "bench.h"
+#include "../../OT4-HT-display-firmware/src/freq.h"
+#include "../../OT4-HT-display-firmware/src/pitch.h"
+
+enum {
+    ID_FREQ_CAPTURE = BENCH_ID_MARKER + 1,
+    ID_FREQ_READ_EMPTY,
+    ID_FREQ_READ_8,
+    ID_PITCH_LOG2,
+    ID_PITCH_ANALYZE,
+    ID_PITCH_ANALYZE_CACHED,
+    ID_FREQUENCY_TO_NOTE,
+};
+
+// tones across the band, GATE periods in 16 MHz ticks
+static const float tones[] = { 32.7f, 110.0f, 220.0f, 261.6f, 440.0f, 443.1f, 880.0f, 1760.0f, 4186.0f, 9000.0f };
+static const uint8_t TONE_COUNT = sizeof(tones) / sizeof(tones[0]);
+
+volatile uint16_t bench_sink;
+volatile float bench_sink_f;
+
+int main() {
+    bench_name(BENCH_ID_MARKER, PSTR("(marker)"));
+    bench_name(ID_FREQ_CAPTURE, PSTR("freq_capture"));
+    bench_name(ID_FREQ_READ_EMPTY, PSTR("freq_read no edges"));
+    bench_name(ID_FREQ_READ_8, PSTR("freq_read 8 edges"));
+    bench_name(ID_PITCH_LOG2, PSTR("pitch_log2"));
+    bench_name(ID_PITCH_ANALYZE, PSTR("pitch_analyze"));
+    bench_name(ID_PITCH_ANALYZE_CACHED, PSTR("pitch_analyze cached"));
+    bench_name(ID_FREQUENCY_TO_NOTE, PSTR("pitch_frequency_to_note"));
+
+    for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+        BENCH(BENCH_ID_MARKER, (void)0);
+    }
+
+    uint32_t stamp = 0;
+    for (uint8_t t = 0; t < TONE_COUNT; t++) {
+        const uint32_t period = (uint32_t)(F_CPU / tones[t]);
+        for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+            for (uint8_t e = 0; e < 8; e++) {
+                stamp += period;
+                BENCH(ID_FREQ_CAPTURE, freq_capture(stamp));
+            }
+            BENCH(ID_FREQ_READ_8, bench_sink_f = freq_read());
+            BENCH(ID_FREQ_READ_EMPTY, bench_sink_f = freq_read());
+        }
+    }
+
+    for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+        for (uint8_t t = 0; t < TONE_COUNT; t++) {
+            const float f = tones[t] + r * 0.01f;
+            const uint32_t x = (uint32_t)(f * 4096.0f);
+            float cents;
+            int16_t midi;
+            BENCH(ID_PITCH_LOG2, bench_sink = (uint16_t)pitch_log2(x));
+            BENCH(ID_PITCH_ANALYZE, bench_sink = pitch_analyze(f, 440.0f)->midi_note);
+            BENCH(ID_PITCH_ANALYZE_CACHED, bench_sink = pitch_analyze(f, 440.0f)->midi_note);
+            BENCH(ID_FREQUENCY_TO_NOTE, bench_sink = (uint16_t)(uintptr_t)pitch_frequency_to_note(f + 0.5f, 440.0f, &cents, &midi));
+        }
+    }
+
+    bench_done();
+    return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file bench_theremin.cpp
+ * @brief cycle benchmark of the theremin signal processing, see bench.h
+ *
+ * log2U16_poly() and cv_poly() are the cubic polynomial log2 and the inline
+ * CV conversion of loop() before the table lookup and cv_task(), kept here
+ * as the reference of the old cost.
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#include "bench.h"
+#include "../../OT4-HT-theremin-firmware/src/ihandlers.h"
+#include "../../OT4-HT-theremin-firmware/src/filter.h"
+#include "../../OT4-HT-theremin-firmware/src/cv.h"
+#include "../../OT4-HT-theremin-firmware/src/quantizer.h"
+
+enum {
+    ID_LOG2 = BENCH_ID_MARKER + 1,
+    ID_LOG2_POLY,
+    ID_CV_TASK_CHANGED,
+    ID_CV_TASK_IDLE,
+    ID_CV_POLY,
+    ID_FILTER_EMA,
+    ID_FILTER_TWO_POLE,
+    ID_FILTER_ADAPTIVE,
+    ID_AUDIO_SAMPLE,
+    ID_PITCH_CAPTURE,
+    ID_VOLUME_CAPTURE,
+    ID_QUANTIZER_HOLD,
+    ID_QUANTIZER_JUMP,
+};
+
+// clamped pitch values across the range, register 2
+static const uint16_t pitches[] = { 1, 37, 512, 1000, 2048, 3047, 4031, 5548, 8191, 9000, 12000, 16383 };
+static const uint8_t PITCH_COUNT = sizeof(pitches) / sizeof(pitches[0]);
+
+volatile uint16_t bench_sink;
+
+#define LOG_SCALE    12
+#define POLY_SHIFT   15
+#define OUTPUT_SHIFT 3
+#define BASE_1_0     32768
+#define POLY_A0  37
+#define POLY_A1  46390
+#define POLY_A2 -18778
+#define POLY_A3   5155
+
+__attribute__((noinline)) uint16_t log2U16_poly(uint16_t lin_input) {
+    if (lin_input == 0)
+        return 0;
+    uint32_t long_lin = ((uint32_t)lin_input) << 16;
+    uint32_t log_output = 0;
+    if (long_lin >= (256UL << 16)) { log_output += (8 << LOG_SCALE); long_lin >>= 8; }
+    if (long_lin >= (16UL << 16))  { log_output += (4 << LOG_SCALE); long_lin >>= 4; }
+    if (long_lin >= (4UL << 16))   { log_output += (2 << LOG_SCALE); long_lin >>= 2; }
+    if (long_lin >= (2UL << 16))   { log_output += (1 << LOG_SCALE); long_lin >>= 1; }
+    long_lin >>= 1;
+    int32_t x = (int32_t)long_lin - BASE_1_0;
+    int32_t x2 = ((int64_t)x * x) >> POLY_SHIFT;
+    int32_t x3 = ((int64_t)x2 * x) >> POLY_SHIFT;
+    int32_t poly = POLY_A0
+                 + (((int64_t)POLY_A1 * x) >> POLY_SHIFT)
+                 + (((int64_t)POLY_A2 * x2) >> POLY_SHIFT)
+                 + (((int64_t)POLY_A3 * x3) >> POLY_SHIFT);
+    log_output += (poly >> OUTPUT_SHIFT);
+    return (uint16_t)log_output;
+}
+
+__attribute__((noinline)) void cv_poly(uint16_t clampedPitch, uint8_t registerValue) {
+    int16_t cv;
+    uint16_t log_freq = log2U16_poly(clampedPitch);
+    if (log_freq >= 37104) {
+        cv = (int16_t)((819 * (int32_t)(log_freq - 37104)) >> 12);
+        cv >>= registerValue - 1;
+    } else {
+        cv = 0;
+    }
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        pitchCV = cv;
+        pitchCVAvailable = true;
+    }
+}
+
+static void bench_filter(uint8_t id, uint8_t mode) {
+    filter_t f = { mode, 4, false, 0, 0, 0, 0 };
+    filter_update(&f, 21000);
+    for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+        for (uint8_t i = 0; i < PITCH_COUNT; i++) {
+            const int32_t x = 21000 - (int32_t)(pitches[i] >> 2);
+            BENCH(id, bench_sink = (uint16_t)filter_update(&f, x));
+        }
+    }
+}
+
+int main() {
+    bench_name(BENCH_ID_MARKER, PSTR("(marker)"));
+    bench_name(ID_LOG2, PSTR("log2U16"));
+    bench_name(ID_LOG2_POLY, PSTR("log2U16 polynomial (old)"));
+    bench_name(ID_CV_TASK_CHANGED, PSTR("cv_task new pitch"));
+    bench_name(ID_CV_TASK_IDLE, PSTR("cv_task same pitch"));
+    bench_name(ID_CV_POLY, PSTR("loop() CV conversion (old)"));
+    bench_name(ID_FILTER_EMA, PSTR("filter_update EMA"));
+    bench_name(ID_FILTER_TWO_POLE, PSTR("filter_update two-pole"));
+    bench_name(ID_FILTER_ADAPTIVE, PSTR("filter_update adaptive"));
+    bench_name(ID_AUDIO_SAMPLE, PSTR("ihAudioSample"));
+    bench_name(ID_PITCH_CAPTURE, PSTR("ihPitchCapture"));
+    bench_name(ID_VOLUME_CAPTURE, PSTR("ihVolumeCapture"));
+    bench_name(ID_QUANTIZER_HOLD, PSTR("quantizer_update same note"));
+    bench_name(ID_QUANTIZER_JUMP, PSTR("quantizer_update new note"));
+
+    for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+        BENCH(BENCH_ID_MARKER, (void)0);
+    }
+
+    for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+        for (uint8_t i = 0; i < PITCH_COUNT; i++) {
+            const uint16_t x = pitches[i];
+            BENCH(ID_LOG2, bench_sink = log2U16(x));
+            BENCH(ID_LOG2_POLY, bench_sink = log2U16_poly(x));
+            BENCH(ID_CV_POLY, cv_poly(x, 2));
+            cv_set_pitch(x, 2);
+            BENCH(ID_CV_TASK_CHANGED, cv_task());
+            BENCH(ID_CV_TASK_IDLE, cv_task());
+        }
+    }
+
+    bench_filter(ID_FILTER_EMA, FILTER_MODE_EMA);
+    bench_filter(ID_FILTER_TWO_POLE, FILTER_MODE_TWO_POLE);
+    bench_filter(ID_FILTER_ADAPTIVE, FILTER_MODE_ADAPTIVE);
+
+    vScaledVolume = 40000;
+    for (uint8_t i = 0; i < PITCH_COUNT; i++) {
+        setWavetableSampleAdvance(pitches[i] >> 2);
+        for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+            BENCH(ID_AUDIO_SAMPLE, bench_sink = ihAudioSample());
+        }
+    }
+
+    uint16_t capture = 0;
+    for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+        capture += 21000 + r;
+        BENCH(ID_PITCH_CAPTURE, ihPitchCapture(capture));
+        BENCH(ID_VOLUME_CAPTURE, ihVolumeCapture(capture >> 1));
+    }
+
+    // hard snap and the default glide, register 2: the hand near one note, then jumps
+    quantizer_init();
+    quantizer_set_concert_a(442);
+    for (uint8_t i = 0; i < PITCH_COUNT; i++) {
+        for (uint8_t r = 0; r < BENCH_REPEAT; r++) {
+            BENCH(ID_QUANTIZER_HOLD, bench_sink = quantizer_update(pitches[i] + r, 2));
+        }
+        BENCH(ID_QUANTIZER_JUMP, bench_sink = quantizer_update(pitches[PITCH_COUNT - 1 - i], 2));
+    }
+
+    bench_done();
+    return 0;
+}
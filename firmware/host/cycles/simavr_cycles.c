@@ -0,0 +1,121 @@
+/**
+ * @file simavr_cycles.c
+ * @brief cycle counts per function of a benchmark firmware on a simulated ATmega328P
+ *
+ * usage: simavr_cycles <bench_xxx.elf>
+ *
+ * Runs the firmware cycle-accurately until it sleeps with interrupts off and
+ * reports, per id named through bench_name(), the calls and the min / avg / max
+ * cycles between the GPIOR0 markers of BENCH() (see bench.h), the empty marker
+ * pair (BENCH_ID_MARKER) taken off.
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+
+#define GPIOR0_ADDR     0x3E    // data space addresses, ATmega328P
+#define GPIOR1_ADDR     0x4A
+#define GPIOR2_ADDR     0x4B
+
+#define BENCH_IDS       64
+#define BENCH_ID_MARKER 1
+#define NAME_LENGTH     32
+#define CYCLE_LIMIT     500000000ULL    // 31 s of simulated time
+
+typedef struct {
+    char name[NAME_LENGTH];
+    uint8_t length;
+    uint64_t calls;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+} bench_stat_t;
+
+static bench_stat_t stats[BENCH_IDS];
+static uint8_t running = 0;             // id between the markers, 0 = none
+static uint8_t naming = 0;              // id of the name being received
+static avr_cycle_count_t started = 0;
+
+static void on_marker(struct avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param) {
+    if (v) {
+        running = v;
+        started = avr->cycle;
+        return;
+    }
+    if (running == 0 || running >= BENCH_IDS) { return; }
+    bench_stat_t *s = &stats[running];
+    const uint64_t cycles = avr->cycle - started;
+    if (s->calls == 0 || cycles < s->min) { s->min = cycles; }
+    if (cycles > s->max) { s->max = cycles; }
+    s->sum += cycles;
+    s->calls++;
+    running = 0;
+}
+
+static void on_name_id(struct avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param) {
+    naming = v;
+    if (naming < BENCH_IDS) { stats[naming].length = 0; }
+}
+
+static void on_name_char(struct avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param) {
+    if (naming >= BENCH_IDS) { return; }
+    bench_stat_t *s = &stats[naming];
+    if (v && s->length < NAME_LENGTH - 1) { s->name[s->length++] = (char)v; }
+    s->name[s->length] = '\0';
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <bench.elf>\n", argv[0]);
+        return 2;
+    }
+
+    elf_firmware_t firmware;
+    memset(&firmware, 0, sizeof(firmware));
+    if (elf_read_firmware(argv[1], &firmware) != 0) {
+        fprintf(stderr, "%s: can't read %s\n", argv[0], argv[1]);
+        return 2;
+    }
+    if (!firmware.mmcu[0]) { strcpy(firmware.mmcu, "atmega328p"); }
+    if (!firmware.frequency) { firmware.frequency = 16000000; }
+
+    avr_t *avr = avr_make_mcu_by_name(firmware.mmcu);
+    if (!avr) {
+        fprintf(stderr, "%s: unknown MCU %s\n", argv[0], firmware.mmcu);
+        return 2;
+    }
+    avr_init(avr);
+    avr_load_firmware(avr, &firmware);
+    avr_register_io_write(avr, GPIOR0_ADDR, on_marker, NULL);
+    avr_register_io_write(avr, GPIOR1_ADDR, on_name_char, NULL);
+    avr_register_io_write(avr, GPIOR2_ADDR, on_name_id, NULL);
+
+    int state = cpu_Running;
+    while (state != cpu_Done && state != cpu_Crashed && avr->cycle < CYCLE_LIMIT) {
+        state = avr_run(avr);
+    }
+    if (state != cpu_Done) {
+        fprintf(stderr, "%s: %s\n", argv[0], state == cpu_Crashed ? "firmware crashed" : "cycle limit reached");
+        return 1;
+    }
+
+    const uint64_t overhead = stats[BENCH_ID_MARKER].calls ? stats[BENCH_ID_MARKER].min : 0;
+    printf("%-28s %8s %8s %8s %8s   (cycles @ 16 MHz, marker overhead %llu removed)\n",
+           "function", "calls", "min", "avg", "max", (unsigned long long)overhead);
+    for (int id = BENCH_ID_MARKER + 1; id < BENCH_IDS; id++) {
+        const bench_stat_t *s = &stats[id];
+        if (!s->calls) { continue; }
+        printf("%-28s %8llu %8llu %8llu %8llu\n", s->name[0] ? s->name : "?",
+               (unsigned long long)s->calls,
+               (unsigned long long)(s->min - overhead),
+               (unsigned long long)(s->sum / s->calls - overhead),
+               (unsigned long long)(s->max - overhead));
+    }
+    return 0;
+}
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+@file gen_traces.py
+@brief Generates the replay traces of traces/ from an oscillator model.
+
+theremin_sweep.trace: Timer1 captures of the F_PITCH and F_VOL edges while a
+hand moves towards both antennas, with vibrato, a few ticks of jitter, one
+lost pitch edge and filter mode changes, plus audio sample runs.
+
+display_glissando.trace: GATE edge timestamps of a 220..880 Hz glissando with
+a runt edge, a signal dropout, a held A4 at two concert A settings and tones
+below and above the measured band, drained every 2 ms like the display loop
+and shown every 20 ms like the tuner view.
+
+The format of both is described in replay_theremin.cpp / replay_display.cpp;
+traces recorded on a board in the same format can be added next to these,
+make golden writes their expected output.
+
+usage: python3 gen_traces.py   (no external dependencies)
+
+(c) GNU GPL v3 or later.
+"""
+
+import math
+import os
+import random
+
+TRACE_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), "traces")
+CLOCK_HZ = 16000000
+
+
+def theremin_sweep():
+    rng = random.Random(27)
+    duration = 0.25
+    events = []     # (time in ticks, line)
+
+    def pitch_period(t):
+        # held note, then the hand closes in: the period drops by 1500 ticks
+        approach = min(max((t - 0.08) / 0.1, 0.0), 1.0)
+        return 21000 - 1500 * (0.5 - 0.5 * math.cos(math.pi * approach)) + 20 * math.sin(2 * math.pi * 6 * t)
+
+    def volume_period(t):
+        return 12500 + 1500 * min(max((t - 0.05) / 0.15, 0.0), 1.0)
+
+    for kind, period_of in (("P", pitch_period), ("V", volume_period)):
+        ticks = 1000 if kind == "P" else 5000
+        lost = False
+        while ticks < duration * CLOCK_HZ:
+            t = ticks / CLOCK_HZ
+            ticks += int(round(period_of(t))) + rng.randint(-2, 2)
+            if kind == "P" and not lost and t > 0.15:
+                lost = True     # lost edge: one capture spans two periods
+                continue
+            events.append((ticks, "%s %d" % (kind, ticks & 0xFFFF)))
+
+    for t, line in ((0.0, "F p 0 2"), (0.0, "F v 0 2"), (0.09, "F p 1 3"),
+                    (0.17, "F p 2 4"), (0.12, "F v 1 2")):
+        events.append((int(t * CLOCK_HZ) - 1, line))
+    events.sort()
+
+    out = ["# generated by gen_traces.py, do not edit",
+           "# theremin counters, hand approaching both antennas, 250 ms",
+           "B 23000 2"]
+    out += [line for _, line in events]
+    out += ["# audio path: low and high increment, half volume, top of the range",
+            "A 1000 65535 32", "A 5000 32768 32", "A 16383 65535 16"]
+    return out
+
+
+def display_glissando():
+    rng = random.Random(31)
+    events = []             # (time in s, line)
+    stamp = 0xFFF00000      # wraps the 32-bit timebase during the glissando
+
+    # (start, end, frequency at start, frequency at end), no edges between the segments
+    segments = [(0.00, 0.80, 220.0, 880.0), (1.00, 1.60, 440.0, 440.0), (1.80, 2.00, 25.0, 25.0),
+                (2.20, 2.40, 12000.0, 12000.0), (2.40, 2.60, 440.0, 440.0)]
+    runt_done = False
+    for start, end, f0, f1 in segments:
+        stamp += int((start - (events[-1][0] if events else 0.0)) * CLOCK_HZ) if events else 0
+        t = start
+        while t < end:
+            period = CLOCK_HZ / (f0 * (f1 / f0) ** ((t - start) / (end - start)))
+            if not runt_done and t > 0.3:
+                runt_done = True    # runt edge a third into a period
+                events.append((t + period / 3 / CLOCK_HZ, "C %d" % ((stamp + int(period / 3)) & 0xFFFFFFFF)))
+            stamp += int(round(period)) + rng.randint(-1, 1)
+            t += period / CLOCK_HZ
+            events.append((t, "C %d" % (stamp & 0xFFFFFFFF)))
+
+    events += [(1.3, "A 442"), (1.7, "A 440")]
+    # a loop pass every 2 ms drains the capture ring, every 10th is a tuner refresh
+    events += [(n * 0.002, ("R %d" if n % 10 == 0 else "L %d") % (n * 2)) for n in range(1, 1401)]
+    events.sort(key=lambda e: e[0])
+
+    out = ["# generated by gen_traces.py, do not edit",
+           "# GATE edges: glissando, runt edge, dropout, held A4 at 440 / 442 Hz, out of band tones"]
+    out += [line for _, line in events]
+    return out
+
+
+def main():
+    os.makedirs(TRACE_DIR, exist_ok=True)
+    for name, lines in (("theremin_sweep.trace", theremin_sweep()),
+                        ("display_glissando.trace", display_glissando())):
+        with open(os.path.join(TRACE_DIR, name), "w") as f:
+            f.write("\n".join(lines) + "\n")
+        print("%s: %d lines" % (name, len(lines)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,2 @@
+/* host stand-in of <avr/pgmspace.h> for the generated wavetable headers, see platform.h */
+#include "../../../platform.h"
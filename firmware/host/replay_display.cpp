@@ -0,0 +1,75 @@
+/**
+ * @file replay_display.cpp
+ * @brief replays GATE capture timestamps through the host build of the tuner math
+ *
+ * Reads a trace on stdin, one directive per line, '#' starts a comment:
+ *
+ *   C <stamp>      extended Timer1 capture of a GATE edge, 16 MHz ticks (ISR(TIMER1_CAPT_vect))
+ *   A <hz>         concert A of the note analysis
+ *   L <ms>         freq_read() at millis() = ms, a pass of loop()
+ *   R <ms>         the same, shown: the tuner refresh of loop()
+ *
+ * and writes one line per R on stdout:
+ *
+ *   R <ms> <freq> <note> <cents> <midi> <midi_cents>
+ *
+ * freq with 3 decimals, note as "-" for no note (spaces shown as '_').
+ * The stamps go through freq_capture() / freq_read(), the frequency through
+ * pitch_analyze() and pitch_frequency_to_note().
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#include <stdio.h>
+#include "../OT4-HT-display-firmware/src/freq.h"
+#include "../OT4-HT-display-firmware/src/pitch.h"
+
+static unsigned long now_ms = 0;
+
+unsigned long millis() { return now_ms; }
+
+int main() {
+    float concert_a = 440.0f;
+    char line[128];
+
+    while (fgets(line, sizeof(line), stdin)) {
+        unsigned long value;
+        float hz;
+
+        switch (line[0]) {
+            case 'C':
+                if (sscanf(line + 1, "%lu", &value) == 1) { freq_capture((uint32_t)value); }
+                break;
+
+            case 'A':
+                if (sscanf(line + 1, "%f", &hz) == 1) { concert_a = hz; }
+                break;
+
+            case 'L':
+                if (sscanf(line + 1, "%lu", &value) == 1) {
+                    now_ms = value;
+                    freq_read();
+                }
+                break;
+
+            case 'R': {
+                if (sscanf(line + 1, "%lu", &value) != 1) { break; }
+                now_ms = value;
+                const float freq = freq_read();
+                float cents = 0;
+                int16_t midi = 0;
+                char note[8];
+                snprintf(note, sizeof(note), "%s", pitch_frequency_to_note(freq, concert_a, &cents, &midi));
+                for (char *c = note; *c; c++) { if (*c == ' ') { *c = '_'; } }
+                printf("R %lu %.3f %s %d %d %lu\n", now_ms, freq, note[0] ? note : "-", (int)cents, midi,
+                       (unsigned long)pitch_analyze(freq, concert_a)->midi_cents);
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+    return 0;
+}
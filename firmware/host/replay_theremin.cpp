@@ -0,0 +1,100 @@
+/**
+ * @file replay_theremin.cpp
+ * @brief replays a theremin counter trace through the host build of the ISR and loop math
+ *
+ * Reads a trace on stdin, one directive per line, '#' starts a comment:
+ *
+ *   B <base> <register>        pitch calibration base and register of the clamped pitch
+ *   F <p|v> <mode> <shift>     filter mode (FILTER_MODE_xxx) and shift of the pitch or volume filter
+ *   P <capture>                Timer1 capture of an F_PITCH edge (ICR1)
+ *   V <capture>                Timer1 stamp of an F_VOL edge (TCNT1 in ISR(INT0_vect))
+ *   A <increment> <volume> <n> n samples of the ISR audio path
+ *
+ * and writes one result line per P, V and per 8 audio samples on stdout:
+ *
+ *   P <pitch> <pitch_v> <clamped> <log2U16(clamped)> <pitchCV>
+ *   V <vol> <vol_v>
+ *   A <frame> x 8              DAC frames, GATE level in bit 15
+ *
+ * The captures go through ihPitchCapture() / ihVolumeCapture() (the debounced
+ * capture branch of ISR(INT1_vect)), the values through filter_update() as in
+ * pitch_task() / volume_task() (pots at 0), the clamped pitch through
+ * cv_set_pitch() / cv_task().
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#include <stdio.h>
+#include "../OT4-HT-theremin-firmware/src/ihandlers.h"
+#include "../OT4-HT-theremin-firmware/src/filter.h"
+#include "../OT4-HT-theremin-firmware/src/cv.h"
+
+#if CV_OUTPUT_MODE != CV_OUTPUT_MODE_LOG
+    #error "the replay checks the log CV, build with -DCV_OUTPUT_MODE=CV_OUTPUT_MODE_LOG"
+#endif
+
+unsigned long millis() { return 0; }
+
+int main() {
+    int32_t base = 0;
+    unsigned reg = 2;
+    char line[128];
+
+    while (fgets(line, sizeof(line), stdin)) {
+        char which;
+        unsigned a, b, c;
+
+        switch (line[0]) {
+            case 'B':
+                if (sscanf(line + 1, "%u %u", &a, &b) == 2) { base = (int32_t)a; reg = b; }
+                break;
+
+            case 'F':
+                if (sscanf(line + 1, " %c %u %u", &which, &a, &b) == 3) {
+                    filter_t *f = (which == 'p') ? &pitch_filter : &volume_filter;
+                    filter_set_mode(f, (uint8_t)a);
+                    filter_set_shift(f, (uint8_t)b);
+                }
+                break;
+
+            case 'P': {
+                if (sscanf(line + 1, "%u", &a) != 1) { break; }
+                ihPitchCapture((uint16_t)a);
+                const int32_t pitch_v = filter_update(&pitch_filter, pitch);
+                int32_t clamped = (base - pitch_v) + 2048;
+                if (clamped < 0) { clamped = 0; } else if (clamped > 16383) { clamped = 16383; }
+                cv_set_pitch((uint16_t)clamped, (uint8_t)reg);
+                cv_task();
+                printf("P %u %ld %ld %u %d\n", pitch, (long)pitch_v, (long)clamped,
+                       log2U16((uint16_t)clamped), pitchCV);
+                pitchValueAvailable = false;
+                break;
+            }
+
+            case 'V': {
+                if (sscanf(line + 1, "%u", &a) != 1) { break; }
+                ihVolumeCapture((uint16_t)a);
+                uint16_t sample = vol;
+                if (sample < 5000) { sample = 5000; }
+                printf("V %u %ld\n", vol, (long)filter_update(&volume_filter, sample));
+                volumeValueAvailable = false;
+                break;
+            }
+
+            case 'A':
+                if (sscanf(line + 1, "%u %u %u", &a, &b, &c) != 3) { break; }
+                setWavetableSampleAdvance((uint16_t)a);
+                vScaledVolume = (uint16_t)b;
+                for (unsigned i = 0; i < c; i++) {
+                    printf((i & 7) ? " %04x" : "A %04x", ihAudioSample());
+                    if ((i & 7) == 7 || i == c - 1) { printf("\n"); }
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+    return 0;
+}
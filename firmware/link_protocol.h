@@ -0,0 +1,128 @@
+/*
+ * link_protocol.h - framed UART messages between the theremin and the display board
+ *
+ * The link keeps the single-byte STATE_CMD_xxx opcodes of build_options.h,
+ * frames are interleaved with them:
+ *
+ *   LINK_SYNC  type  payload[link_payload_length(type)]  crc8
+ *
+ * The CRC-8 (polynomial 0x07, init 0) covers type and payload.
+ * LINK_SYNC is never used as a single-byte opcode, every other byte received
+ * outside a frame is a STATE_CMD_xxx (or debug text) as before.
+ * Older firmware does not know the frames: it takes the type and payload bytes
+ * for opcodes, and it also runs the link at the former SERIAL_SPEED. Both
+ * boards must be updated together.
+ *
+ * Multi-byte payload values are little endian.
+ */
+
+#ifndef _LINK_PROTOCOL_H_
+#define _LINK_PROTOCOL_H_
+
+#include <Arduino.h>
+
+#define LINK_SYNC                   0xF5    // start of a frame
+
+/*
+ * LINK_FRAME_STATUS, theremin -> display every LINK_STATUS_PERIOD_MS
+ *   uint16_t increment   vPointerIncrement, 10.6 DDS phase step per 31250 Hz sample
+ *                        f = increment * 31250 / 65536 Hz
+ *   uint8_t  register    octave register (1..3, playing octave shift)
+ *   uint8_t  volume      output volume 0..255, 0 when muted
+ */
+#define LINK_FRAME_STATUS           0x01
+#define LINK_FRAME_STATUS_LENGTH    4
+
+#define LINK_PAYLOAD_MAX            4       // longest payload of all frame types
+
+#define LINK_STATUS_PERIOD_MS       20      // status frame rate of the theremin (50 Hz)
+#define LINK_STATUS_TIMEOUT_MS      100     // display falls back to the GATE measurement after this
+
+typedef enum {
+    link_result_t_pending,      // byte taken into a frame, nothing to do yet
+    link_result_t_command,      // byte outside a frame: a single-byte STATE_CMD_xxx
+    link_result_t_frame,        // frame completed, type and payload are valid
+    link_result_t_error,        // frame dropped (unknown type or bad CRC)
+} link_result_t;
+
+typedef struct {
+    uint8_t state;              // 0 = idle, 1 = type, 2 = payload, 3 = crc
+    uint8_t type;
+    uint8_t length;
+    uint8_t index;
+    uint8_t crc;
+    uint8_t payload[LINK_PAYLOAD_MAX];
+} link_parser_t;
+
+static inline uint8_t link_crc8(uint8_t crc, uint8_t data) {
+    crc ^= data;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+
+/**
+ * @return payload length of a frame type, 0xff for unknown types.
+ */
+static inline uint8_t link_payload_length(uint8_t type) {
+    switch (type) {
+        case LINK_FRAME_STATUS: return LINK_FRAME_STATUS_LENGTH;
+        default: return 0xff;
+    }
+}
+
+/**
+ * @brief Sends a frame with a single Serial.write(), so it is never split by other output.
+ */
+static inline void link_send_frame(uint8_t type, const uint8_t *payload, uint8_t length) {
+    uint8_t frame[LINK_PAYLOAD_MAX + 3];
+    uint8_t crc = link_crc8(0, type);
+    frame[0] = LINK_SYNC;
+    frame[1] = type;
+    for (uint8_t i = 0; i < length; i++) {
+        frame[2 + i] = payload[i];
+        crc = link_crc8(crc, payload[i]);
+    }
+    frame[2 + length] = crc;
+    Serial.write(frame, length + 3);
+}
+
+/**
+ * @brief Feeds one received byte into the frame parser.
+ *
+ * @return link_result_t_command if the byte is a single-byte opcode to be handled
+ *         as before, link_result_t_frame when p->type and p->payload hold a new frame.
+ */
+static inline link_result_t link_parse(link_parser_t *p, uint8_t b) {
+    switch (p->state) {
+        case 0:
+            if (b != LINK_SYNC) { return link_result_t_command; }
+            p->state = 1;
+            return link_result_t_pending;
+
+        case 1:
+            p->type = b;
+            p->length = link_payload_length(b);
+            if (p->length > LINK_PAYLOAD_MAX) {
+                p->state = 0;
+                return link_result_t_error;
+            }
+            p->crc = link_crc8(0, b);
+            p->index = 0;
+            p->state = p->length ? 2 : 3;
+            return link_result_t_pending;
+
+        case 2:
+            p->payload[p->index++] = b;
+            p->crc = link_crc8(p->crc, b);
+            if (p->index == p->length) { p->state = 3; }
+            return link_result_t_pending;
+
+        default:
+            p->state = 0;
+            return (b == p->crc) ? link_result_t_frame : link_result_t_error;
+    }
+}
+
+#endif // _LINK_PROTOCOL_H_
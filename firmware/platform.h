@@ -0,0 +1,53 @@
+/**
+ * @file platform.h
+ * @brief hardware seam of the signal processing and tuner modules
+ *
+ * The modules without direct register access (filter, cv, pitch, the period
+ * processing of freq and the per-sample math of ihandlers) include this instead
+ * of <Arduino.h>.
+ * On the boards it is Arduino.h. Compiled for a host (no __AVR__), e.g. by a
+ * program replaying recorded counter values or capture timestamps through
+ * them (see firmware/host), it supplies the few AVR / Arduino names they use
+ * instead: the PROGMEM reads, ATOMIC_BLOCK and millis(), which the host program
+ * defines. The code under __AVR__ in the modules (timers, ISRs) is left out.
+ *
+ * GNU GPL v3 or later.
+ *
+ */
+
+#ifndef _PLATFORM_H_
+#define _PLATFORM_H_
+
+#ifdef __AVR__
+
+#include <Arduino.h>
+#include <util/atomic.h>
+
+#else // host
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef F_CPU
+#define F_CPU                       16000000UL  // clock of both boards, scales the timer counts
+#endif
+
+#define PROGMEM
+#define pgm_read_byte(addr)         (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)         (*(const uint16_t *)(addr))
+#define pgm_read_ptr(addr)          (*(const void *const *)(addr))
+#define pgm_read_byte_near(addr)    pgm_read_byte(addr)
+#define pgm_read_word_near(addr)    pgm_read_word(addr)
+#define memcpy_P                    memcpy
+
+// single threaded on the host: the block just runs once
+#define ATOMIC_RESTORESTATE         0
+#define ATOMIC_BLOCK(type)          for (uint8_t _atomic_once = 1; _atomic_once; _atomic_once = 0)
+
+unsigned long millis();             // time base of the host program
+
+#endif // __AVR__
+
+#endif // _PLATFORM_H_